@@ -5,6 +5,7 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include "interpreter.h"
+#include "utils/parallel.h"
 
 /**
  * @author LUDWIG Corentin
@@ -41,7 +42,9 @@ Command* interprete(int argc, char *argv[])
     int c;
     command->file_name[0] = '\0';
     command->log_file[0] = '\0';
-    while ((c = getopt(argc, argv, "-i:-d:-j:-o:-m:")) != -1)
+    char *end;
+    long nb_threads;
+    while ((c = getopt(argc, argv, "-i:-d:-j:-o:-m:-t:")) != -1)
     {
         switch (c)
         {
@@ -103,6 +106,20 @@ Command* interprete(int argc, char *argv[])
         }
             break;
 
+        case 't':
+        if (command->nb_threads == 0){
+            nb_threads = strtol(optarg, &end, 10);
+            if (*optarg == '\0' || *end != '\0' || nb_threads < 1 || nb_threads > PARALLEL_MAX_THREADS) {
+                free(command);
+                exitl("interpreter", "intrepreter", EINVLARG, "le nombre de threads doit etre compris entre 1 et %d\n", PARALLEL_MAX_THREADS);
+            }
+            command->nb_threads = (unsigned)nb_threads;
+        } else {
+            free(command);
+            exitl("interpreter", "intrepreter", EINCMPTB, "il ne peut avoir qu'une seul balise de threads\n");
+        }
+            break;
+
         case '?':
             free(command);
             exitl("interpreter", "intrepreter", EUNKWARG, "balise non reconnu ou argument manquant\n");
@@ -43,6 +43,7 @@ typedef struct command_t {
     char file_name[MAX_FILE_NAME];      /* Nom du fichier de vote */
     bool has_log_file;    
     char log_file[MAX_FILE_NAME];       /* Potentiel nom du fichier de log */
+    unsigned nb_threads;  /* Nombre de threads des calculs (-t), 0 : nombre de processeurs */
 } Command;
 
 /************
@@ -237,16 +237,13 @@ void displayMatrixLog(Matrix *m) {
 void displayBaleLog(Bale *b) {
     unsigned nb_cand = baleNbCandidat(b);
     unsigned nb_voter = baleNbVoter(b);
+    unsigned nb_line = baleNbLine(b);
     printl("\n %s┌────────────────────────────── BALLOT (%d,%d)... \n", c_yellow, nb_voter, nb_cand);
     printl(" │\n ├────────────── Liste des candidats :%s\n", c_rstc);
 
     /* candidats */
-    char* label;
-    for(unsigned i = 0; i < nb_cand; i++) {
-        label = baleColumnToLabel(b, i);
-        printl(" %s├─%s C%-2d : %s %s\n", c_yellow, c_orange, i+1, label, c_rstc);
-        free(label);
-    }
+    for(unsigned i = 0; i < nb_cand; i++)
+        printl(" %s├─%s C%-2d : %s %s\n", c_yellow, c_orange, i+1, baleColumnToLabel(b, i), c_rstc);
     printl(" %s│\n ├────────────── Votes :%s\n", c_yellow, c_rstc);
 
     /* bordure haute */
@@ -270,12 +267,13 @@ void displayBaleLog(Bale *b) {
     }
     printl("─────┤\n");
 
-    /* affichage données */
-    for(unsigned l = 0; l < nb_voter-1; l++) {
+    /* affichage données (poids de la ligne si plusieurs votants l'ont exprimée) */
+    for(unsigned l = 0; l < nb_line-1; l++) {
         printl(" %s│%s │", c_yellow, c_rstc);
         for(unsigned c = 0; c < nb_cand; c++) {
             printl(" %3d │", baleGetValue(b, l, c));
         }
+        if(baleLineWeight(b, l) != 1) printl(" x%u", baleLineWeight(b, l));
         printl("\n");
         printl(" %s│%s ├", c_yellow, c_rstc);
         for(unsigned c = 0; c < nb_cand-1; c++) {
@@ -284,9 +282,10 @@ void displayBaleLog(Bale *b) {
         printl("─────┤\n");
     }
     printl(" %s│%s │", c_yellow, c_rstc);
-    for(unsigned c = 0; c < nb_cand && nb_voter > 0; c++) {
-        printl(" %3d │", baleGetValue(b, nb_voter-1, c));
+    for(unsigned c = 0; c < nb_cand && nb_line > 0; c++) {
+        printl(" %3d │", baleGetValue(b, nb_line-1, c));
     }
+    if(nb_line > 0 && baleLineWeight(b, nb_line-1) != 1) printl(" x%u", baleLineWeight(b, nb_line-1));
     printl("\n");
 
     /* bordure basse */
@@ -305,12 +304,8 @@ void displayDuelLog(Duel *d) {
     printl(" │\n ├────────────── Liste des candidats :%s\n", c_rstc);
 
     /* candidats */
-    char* label;
-    for(unsigned i = 0; i < nb_cand; i++) {
-        label = duelIndexToLabel(d, i);
-        printl(" %s├─%s C%-2d : %s %s\n", c_yellow, c_orange, i+1, label, c_rstc);
-        free(label);
-    }
+    for(unsigned i = 0; i < nb_cand; i++)
+        printl(" %s├─%s C%-2d : %s %s\n", c_yellow, c_orange, i+1, duelIndexToLabel(d, i), c_rstc);
     printl(" %s│\n ├────────────── Votes :%s\n", c_yellow, c_rstc);
 
     /* bordure haute */
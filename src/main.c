@@ -5,6 +5,8 @@
 #include "module/single_member.h"
 #include "interpreter.h"
 #include "utils/csv_reader.h"
+#include "utils/parallel.h"
+#include "utils/arena.h"
 #include "logger.h"
 
 /**
@@ -20,6 +22,32 @@ void deleteWinners(ptrGenList* winners) {
     deleteGenList(winners);
 }
 
+/**
+ * @date 16/10/2026
+ * @brief libère une liste de gagnants alloués dans l'arène et rend la mémoire de l'arène
+ * (gagnants et objets temporaires de la méthode) pour la méthode suivante
+ *
+ * @param[in] winners la liste à libérer
+ * @param[in] arena l'arène utilisée par la méthode
+ */
+void releaseWinners(ptrGenList* winners, Arena* arena) {
+    deleteGenList(winners);
+    arenaReset(arena);
+}
+
+/**
+ * @date 16/10/2026
+ * @brief remplace un ballot par son ballot compacté (ballots identiques regroupés avec leur
+ * poids), les méthodes de scrutin ne parcourent ainsi que les ballots distincts
+ *
+ * @param[in,out] bale le ballot à compacter
+ */
+void compactBale(Bale** bale) {
+    Bale* compact = baleCompact(*bale);
+    deleteBale(bale);
+    *bale = compact;
+}
+
 /**
  * @date 15/12/2023
  * @author LAFORGE Mateo
@@ -52,12 +80,12 @@ void uni2(Bale* bale) {
  * @brief applique la méthode minimax sur le fichier source_file et affiche son résultat pour l'utilisateur
  * 
  * @param[in] duel la matrice de duels fournie par l'utilisateur en entrée
- * @param[in] nb_voters nombre de votants (si il a été possible de l'extraire, NULL sinon)
+ * @param[in] arena arène des allocations de la méthode
  */
-void minimax(Duel* duel) {
-    GenList* winners = theWinnerMinimax(duel);
+void minimax(Duel* duel, Arena* arena) {
+    GenList* winners = theWinnerMinimaxArena(duel, arena);
     displayListWinnerCondorcet(winners, "minimax");
-    deleteWinners(&winners);
+    releaseWinners(&winners, arena);
 }
 
 /**
@@ -66,12 +94,12 @@ void minimax(Duel* duel) {
  * @brief applique la méthode de rangement des pairs sur le fichier source_file et affiche son résultat pour l'utilisateur
  * 
  * @param[in] duel la matrice de duels fournie par l'utilisateur en entrée
- * @param[in] nb_voters nombre de votants (si il a été possible de l'extraire, NULL sinon)
+ * @param[in] arena arène des allocations de la méthode
  */
-void rankedPairs(Duel* duel) {
-    GenList* winners = theWinnerRankedPairs(duel);
+void rankedPairs(Duel* duel, Arena* arena) {
+    GenList* winners = theWinnerRankedPairsArena(duel, arena);
     displayListWinnerCondorcet(winners, "rangement des pairs");
-    deleteWinners(&winners);
+    releaseWinners(&winners, arena);
 }
 
 /**
@@ -80,12 +108,12 @@ void rankedPairs(Duel* duel) {
  * @brief applique la méthode de schulze sur le fichier source_file et affiche son résultat pour l'utilisateur
  * 
  * @param[in] duel la matrice de duels fournie par l'utilisateur en entrée
- * @param[in] nb_voters nombre de votants (si il a été possible de l'extraire, NULL sinon)
+ * @param[in] arena arène des allocations de la méthode
  */
-void schulze(Duel* duel) {
-    GenList* winners = theWinnerSchulze(duel);
+void schulze(Duel* duel, Arena* arena) {
+    GenList* winners = theWinnerSchulzeArena(duel, arena);
     displayListWinnerCondorcet(winners, "schulze");
-    deleteWinners(&winners);
+    releaseWinners(&winners, arena);
 }
 
 /**
@@ -94,11 +122,12 @@ void schulze(Duel* duel) {
  * @brief applique la méthode du jugement majoritaire sur le fichier source_file et affiche son résultat pour l'utilisateur
  * 
  * @param[in] bale le ballot fournit par l'utilisateur en entrée
+ * @param[in] arena arène des allocations de la méthode
  */
-void majorityJudgment(Bale* bale) {
-    GenList* winners = theWinnerMajorityJudgment(bale,false);
+void majorityJudgment(Bale* bale, Arena* arena) {
+    GenList* winners = theWinnerMajorityJudgmentArena(bale, false, arena);
     displayListWinnerMajorityJudgment(winners);
-    deleteWinners(&winners);
+    releaseWinners(&winners, arena);
 }
 
 /**
@@ -128,25 +157,87 @@ void printNumbersFromDuel(Duel* duel, unsigned* nb_voters) {
     }
 }
 
+/**
+ * @date 16/10/2026
+ * @brief Méthodes de Condorcet exécutées par all, dans l'ordre d'affichage
+ */
+static GenList* (*const condorcet_methods[])(CondorcetShared*, Arena*) = {
+    theWinnerMinimaxShared, theWinnerRankedPairsShared, theWinnerSchulzeShared
+};
+/* titre et nom affichés pour chaque méthode de condorcet_methods */
+static const char* const condorcet_titles[] = {" -= Minimax =-\n", " -= Rangement Des Pairs =-\n", " -= Schulze =-\n"};
+static char* const condorcet_names[] = {"minimax", "rangement des pairs", "schulze"};
+
+/* nombre de méthodes de Condorcet exécutées par all */
+#define NB_CONDORCET_METHODS (sizeof(condorcet_methods) / sizeof(condorcet_methods[0]))
+
+
+/**
+ * @date 16/10/2026
+ * @brief Contexte de l'exécution concurrente des méthodes de Condorcet
+ */
+typedef struct s_condorcet_run {
+    CondorcetShared* shared;                    /* prétraitement commun, en lecture seule */
+    Arena* arenas[NB_CONDORCET_METHODS];        /* arène propre à chaque méthode */
+    GenList* winners[NB_CONDORCET_METHODS];     /* gagnants de chaque méthode */
+} CondorcetRun;
+
+
+/**
+ * @date 16/10/2026
+ * @brief Exécute les méthodes id, id + nb_threads, ... (fonction de thread)
+ */
+void condorcetMethodsThread(unsigned id, unsigned nb_threads, void* arg) {
+    CondorcetRun* run = (CondorcetRun*)arg;
+    for (unsigned m = id; m < NB_CONDORCET_METHODS; m += nb_threads)
+        run->winners[m] = condorcet_methods[m](run->shared, run->arenas[m]);
+}
+
+/**
+ * @date 16/10/2026
+ * @brief applique minimax, le rangement des pairs et schulze sur un même prétraitement de la
+ * matrice de duels (vainqueur de Condorcet, duels et arcs triés calculés une seule fois), chacune
+ * sur son thread, puis affiche leurs résultats dans cet ordre
+ *
+ * @param[in] duel la matrice de duels
+ * @param[in] arena arène du prétraitement, remise à zéro à la fin
+ */
+void condorcetMethods(Duel* duel, Arena* arena) {
+    CondorcetRun run;
+    unsigned nb_threads = parallelNbThreads();
+    if (nb_threads > NB_CONDORCET_METHODS) nb_threads = NB_CONDORCET_METHODS;
+
+    run.shared = createCondorcetShared(duel, arena);
+    for (unsigned m = 0; m < NB_CONDORCET_METHODS; m++)
+        run.arenas[m] = createArena(0);
+
+    parallelRun(condorcetMethodsThread, nb_threads, &run);
+
+    for (unsigned m = 0; m < NB_CONDORCET_METHODS; m++) {
+        printl("%s", condorcet_titles[m]);
+        displayListWinnerCondorcet(run.winners[m], condorcet_names[m]);
+        deleteGenList(&run.winners[m]);
+        deleteArena(&run.arenas[m]);
+    }
+    deleteCondorcetShared(&run.shared, arena);
+    arenaReset(arena);
+}
+
 /**
  * @date 15/12/2023
  * @author LAFORGE Mateo
  * @brief applique dans l'ordre de définition toutes les méthodes de scrutins une à une en affichant à chaque fois le résultat
  * 
  * @param[in] cmd la commande interprétée de l'utilisateur
+ * @param[in] arena arène des allocations des méthodes, remise à zéro après chacune
  */
-void all(Command* cmd) {
+void all(Command* cmd, Arena* arena) {
     switch (cmd->file_type) {
         case DUEL: {
             warnl("main", "all", "Une Matrice de duel à été passée en paramètre -> exécution des méthodes de Condorcet\n");
             Duel* duel = csvToDuel(cmd->file_name);
             displayDuelLog(duel);
-            printl(" -= Minimax =-\n");
-            minimax(duel);
-            printl(" -= Rangement Des Pairs =-\n");
-            rankedPairs(duel);
-            printl(" -= Schulze =-\n");
-            schulze(duel);
+            condorcetMethods(duel, arena);
 
             printNumbersFromDuel(duel, NULL);
             deleteDuel(&duel);
@@ -155,6 +246,7 @@ void all(Command* cmd) {
         case BALE: {
             Bale* bale = csvToBale(cmd->file_name);
             displayBaleLog(bale);
+            compactBale(&bale);
 
             printl(" -= Uni1 =-\n");
             uni1(bale);
@@ -164,15 +256,10 @@ void all(Command* cmd) {
             Duel* duel = duelFromBale(bale);
             displayDuelLog(duel);
 
-            printl(" -= Minimax =-\n");
-            minimax(duel);
-            printl(" -= Rangement Des Pairs =-\n");
-            rankedPairs(duel);
-            printl(" -= Schulze =-\n");
-            schulze(duel);
+            condorcetMethods(duel, arena);
 
             printl(" -= Jugment Majoritaire =-\n");
-            majorityJudgment(bale);
+            majorityJudgment(bale, arena);
 
             deleteDuel(&duel);
             printNumbersFromBale(bale);
@@ -203,11 +290,8 @@ Duel* getDuel(Command* cmd, unsigned* nb_voters) {
         case BALE: {
             warnl("main.c", "getDuel",
                 "conversion d'une matrice de duel en ballot\n");
-            Bale* bale = csvToBale(cmd->file_name);
-            duel = duelFromBale(bale);
-            // assigne nb_voters si possible
-            if (nb_voters != NULL) *nb_voters = baleNbVoter(bale);
-            deleteBale(&bale);
+            // lecture votant par votant, sans construire le ballot
+            duel = csvBaleToDuel(cmd->file_name, nb_voters);
             break;
         }
         default:
@@ -227,25 +311,34 @@ int main(int argc, char* argv[]) {
         init_logger(NULL);
     }
 
+    if (cmd->nb_threads > 0)
+        parallelSetNbThreads(cmd->nb_threads);
+
+    /* arène des objets temporaires des méthodes de scrutin */
+    Arena* arena = createArena(0);
+
     switch(cmd->module) {
         case UNI1: {
             Bale* bale = csvToBale(cmd->file_name);
+            compactBale(&bale);
             uni1(bale);
             printNumbersFromBale(bale);
             deleteBale(&bale);
             break;
         }
         case UNI2: {
-            Bale* bale = csvToBale(cmd->file_name); 
-            uni2(bale);
-            printNumbersFromBale(bale);
-            deleteBale(&bale);
+            // lecture votant par votant, sans construire le ballot
+            unsigned nb_voters, nb_candidats;
+            GenList* winners = theWinnerTwoRoundsCsv(cmd->file_name, &nb_voters, &nb_candidats);
+            displayListWinnerSingleTwo(winners);
+            deleteWinners(&winners);
+            printl("Nombre Votants: %d   -   Nombre Candidats: %d\n", nb_voters, nb_candidats);
             break;
         }
         case MINIMAX: {
             unsigned nb_voters;
             Duel* duel = getDuel(cmd, &nb_voters);
-            minimax(duel);
+            minimax(duel, arena);
             printNumbersFromDuel(duel, &nb_voters);
             deleteDuel(&duel);
             break;
@@ -253,7 +346,7 @@ int main(int argc, char* argv[]) {
         case RANGEMENT: {
             unsigned nb_voters;
             Duel* duel = getDuel(cmd, &nb_voters);
-            rankedPairs(duel);
+            rankedPairs(duel, arena);
             printNumbersFromDuel(duel, &nb_voters);
             deleteDuel(&duel);
             break;
@@ -261,25 +354,27 @@ int main(int argc, char* argv[]) {
         case SCHULZE: {
             unsigned nb_voters;
             Duel* duel = getDuel(cmd, &nb_voters);
-            schulze(duel);
+            schulze(duel, arena);
             printNumbersFromDuel(duel, &nb_voters);
             deleteDuel(&duel);
             break;
         }
         case JUGEMENT_MAJORITAIRE: {
             Bale* bale = csvToBale(cmd->file_name);
-            majorityJudgment(bale);
+            compactBale(&bale);
+            majorityJudgment(bale, arena);
             printNumbersFromBale(bale);
             deleteBale(&bale);
             break;
         }
         case ALL:
-            all(cmd);
+            all(cmd, arena);
             break;
         default:
             exitl("main", "main", 1, "le Module renvoyé par l'interpréteur est invalide\n");
     }
 
+    deleteArena(&arena);
     close_logger();
 
     free(cmd);
@@ -1,6 +1,8 @@
 #include <string.h>
+#include <stdint.h>
 #include <malloc.h>
 #include "condorcet.h"
+#include "../utils/parallel.h"
 #include "../structure/graph.h"
 #include "../structure/data_struct_utils.h"
 
@@ -18,7 +20,7 @@
  *
  * @return Le gagnant en utilisant la structure WinnerCondorcet ou NULL s'il n'y a pas de vaiqueur
 */
-WinnerCondorcet* CondorcetWinnerCriterion(Duel* duel) {
+WinnerCondorcet* CondorcetWinnerCriterionArena(Duel* duel, Arena* arena) {
     int nbCandidats= duelNbCandidat(duel);
     int maxWins = 0;
     int winner = -1;
@@ -40,15 +42,144 @@ WinnerCondorcet* CondorcetWinnerCriterion(Duel* duel) {
         }
     }
     if (winner == -1) return NULL;
-    WinnerCondorcet* vainqueur = malloc(sizeof(WinnerCondorcet));
-    char* winner_name =  duelIndexToLabel(duel, winner);
-    strncpy(vainqueur->name, winner_name, MAX_LENGHT_LABEL);
-    free(winner_name);
+    WinnerCondorcet* vainqueur = memAlloc(arena, sizeof(WinnerCondorcet));
+    strncpy(vainqueur->name, duelIndexToLabel(duel, winner), MAX_LENGHT_LABEL);
     vainqueur->score = maxWins;
     return vainqueur;
 }
 
 
+/**
+ * @date 16/10/2026
+ * @brief CondorcetWinnerCriterionArena sans arène : le résultat est alloué avec malloc
+ */
+WinnerCondorcet* CondorcetWinnerCriterion(Duel* duel){
+    return CondorcetWinnerCriterionArena(duel, NULL);
+}
+
+
+/****************************
+*   PRÉTRAITEMENT PARTAGÉ   *
+****************************/
+
+/**
+ * @date 16/10/2026
+ * @brief Copie la matrice des duels dans un tableau plat, lu sans appel de fonction par les méthodes
+ *
+ * @param[in] duel matrice des duels entre tous le candidats
+ *
+ * @return tableau duels, duels[i*nb_cand+j] = duelGetValue(duel, i, j) (à libérer)
+ */
+int* duelsFlatten(Duel* duel, Arena* arena){
+    unsigned nb_cand = duelNbCandidat(duel);
+    int* duels = memAlloc(arena, sizeof(int)*(nb_cand > 0 ? (size_t)nb_cand*nb_cand : 1));
+
+    for(unsigned i = 0; i < nb_cand; i++)
+        for(unsigned j = 0; j < nb_cand; j++)
+            duels[(size_t)i*nb_cand + j] = duelGetValue(duel, i, j);
+    return duels;
+}
+
+
+/**
+ * @date 08/12/2023
+ * @author Alina IVANOVA
+ * @brief creation du tableau des arcs triés par poids décroissant
+ *
+ * @param[in] duels matrice plate des duels (voir @ref duelsFlatten)
+ * @param[in] nb_cand nombre de candidats
+ * @param[out] nb_arcs nombre d'arcs du tableau
+ * @return tableau des arcs (à libérer avec free)
+ */
+Arc* sortedArcsCreate(const int* duels, unsigned nb_cand, unsigned* nb_arcs, Arena* arena){
+    Arc* arcs = memAlloc(arena, ((size_t)nb_cand * nb_cand / 2 + 1) * sizeof(Arc));
+    unsigned n = 0;
+
+    for (unsigned i = 0; i< nb_cand ; i++){
+        for (unsigned j = i+1; j<nb_cand; j++){  
+            //adding the arc or duel to the array
+            int cand1_vs = duels[(size_t)i*nb_cand + j];
+            int cand2_vs = duels[(size_t)j*nb_cand + i];
+            if(cand1_vs>cand2_vs) {
+                arcs[n].id_dest = j;
+                arcs[n].id_src = i;
+                arcs[n].weight = cand1_vs;
+                n++;
+            }
+            else if (cand2_vs > cand1_vs){
+                arcs[n].id_dest = i;
+                arcs[n].id_src = j;
+                arcs[n].weight = cand2_vs;
+                n++;
+            }
+        }    
+    }
+    /* tri stable : à poids égal, la paire (i, j), i < j, la plus petite passe en premier */
+    sortArcs(arcs, n, DESCENDING);
+    *nb_arcs = n;
+    return arcs;
+}
+
+
+/**
+ * @date 16/10/2026
+ */
+CondorcetShared* createCondorcetShared(Duel* duel, Arena* arena){
+#ifdef DEBUG
+    testArgNull(duel, "condorcet.c", "createCondorcetShared", "duel");
+#endif
+
+    CondorcetShared* shared = memAlloc(arena, sizeof(CondorcetShared));
+    shared->duel = duel;
+    shared->winner = CondorcetWinnerCriterionArena(duel, arena);
+    shared->duels = NULL;
+    shared->arcs = NULL;
+    shared->nb_arcs = 0;
+
+    /* avec un vainqueur de Condorcet, aucune méthode ne lit les duels */
+    if(shared->winner == NULL){
+        shared->duels = duelsFlatten(duel, arena);
+        shared->arcs = sortedArcsCreate(shared->duels, duelNbCandidat(duel), &shared->nb_arcs, arena);
+    }
+    return shared;
+}
+
+
+/**
+ * @date 16/10/2026
+ */
+void deleteCondorcetShared(ptrCondorcetShared* shared, Arena* arena){
+#ifdef DEBUG
+    testArgNull(shared, "condorcet.c", "deleteCondorcetShared", "shared");
+    testArgNull(*shared, "condorcet.c", "deleteCondorcetShared", "*shared");
+#endif
+
+    memFree(arena, (*shared)->winner);
+    memFree(arena, (*shared)->duels);
+    memFree(arena, (*shared)->arcs);
+    memFree(arena, *shared);
+    *shared = NULL;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Liste contenant une copie du vainqueur de Condorcet du prétraitement, allouée dans
+ * l'arène de la méthode
+ *
+ * @return la liste, NULL s'il n'y a pas de vainqueur de Condorcet
+ */
+GenList* sharedCondorcetWinner(CondorcetShared* shared, Arena* arena){
+    if(shared->winner == NULL) return NULL;
+
+    WinnerCondorcet* winner = memAlloc(arena, sizeof(WinnerCondorcet));
+    *winner = *shared->winner;
+    GenList* winners = createGenList(1);
+    genListAdd(winners, winner);
+    return winners;
+}
+
+
 
 /**************
 *   MINIMAX   *
@@ -58,38 +189,37 @@ WinnerCondorcet* CondorcetWinnerCriterion(Duel* duel) {
  * @author Alina IVANOVA
  * @date 20/11/2023 
  * @brief creation d'une liste avec le(s) gagnant(s) en utilisant la méthode Minimax
+ *
+ * @param[in] duel matrice des duels (labels des candidats)
+ * @param[in] duels matrice plate des duels (voir @ref duelsFlatten)
  */
-GenList* miniMaxCandidat(Duel* duel){
+GenList* miniMaxCandidat(Duel* duel, const int* duels, Arena* arena){
     int nbCandidats= duelNbCandidat(duel);
     int miniDifference;
     GenList* candidates = createGenList(1);
     for (int cand1 = 0; cand1<nbCandidats;cand1++){
         int maxDiffCandidat = 0;
         for (int cand2 = 0; cand2 < nbCandidats; cand2++){
-            int diff = duelGetValue(duel, cand1, cand2); 
+            int diff = duels[cand1*nbCandidats + cand2];
             if(diff > maxDiffCandidat){
                 maxDiffCandidat = diff;
             }
         }
         
         if (cand1 == 0 || miniDifference>maxDiffCandidat){
-            while(genListSize(candidates)!=0) free((WinnerCondorcet*)genListPop(candidates));
+            while(genListSize(candidates)!=0) memFree(arena, genListPop(candidates));
 
             miniDifference = maxDiffCandidat;
             
-            WinnerCondorcet* cand_possible = malloc(sizeof(WinnerCondorcet));
+            WinnerCondorcet* cand_possible = memAlloc(arena, sizeof(WinnerCondorcet));
             cand_possible->score = maxDiffCandidat;
-            char* winner_name =  duelIndexToLabel(duel, cand1);
-            strncpy(cand_possible->name, winner_name, MAX_LENGHT_LABEL);
-            free(winner_name);
+            strncpy(cand_possible->name, duelIndexToLabel(duel, cand1), MAX_LENGHT_LABEL);
             genListAdd(candidates, cand_possible);
         }
         else if(miniDifference == maxDiffCandidat){
-            WinnerCondorcet* another_cand = malloc(sizeof(WinnerCondorcet));
+            WinnerCondorcet* another_cand = memAlloc(arena, sizeof(WinnerCondorcet));
             another_cand->score = maxDiffCandidat;
-            char* winner_name =  duelIndexToLabel(duel, cand1);
-            strncpy(another_cand->name, winner_name, MAX_LENGHT_LABEL);
-            free(winner_name);
+            strncpy(another_cand->name, duelIndexToLabel(duel, cand1), MAX_LENGHT_LABEL);
             genListAdd(candidates, another_cand);
         }
     }
@@ -105,13 +235,15 @@ GenList* miniMaxCandidat(Duel* duel){
  *
  * @return Le gagnant en utilisant la structure WinnerCondorcet.
 */
-GenList* theWinnerMinimax(Duel* duel){
+GenList* theWinnerMinimaxArena(Duel* duel, Arena* arena){
     GenList* winners;
     WinnerCondorcet* wtmp;
 
-    wtmp = CondorcetWinnerCriterion(duel);
+    wtmp = CondorcetWinnerCriterionArena(duel, arena);
     if (wtmp==NULL) {
-        winners = miniMaxCandidat(duel);
+        int* duels = duelsFlatten(duel, arena);
+        winners = miniMaxCandidat(duel, duels, arena);
+        memFree(arena, duels);
     }
     else {
         winners = createGenList(1);
@@ -120,102 +252,101 @@ GenList* theWinnerMinimax(Duel* duel){
     return winners;
 }
 
+
+/**
+ * @date 16/10/2026
+ * @brief theWinnerMinimaxArena sans arène : le résultat est alloué avec malloc
+ */
+GenList* theWinnerMinimax(Duel* duel){
+    return theWinnerMinimaxArena(duel, NULL);
+}
+
+
+/**
+ * @date 16/10/2026
+ */
+GenList* theWinnerMinimaxShared(CondorcetShared* shared, Arena* arena){
+    GenList* winners = sharedCondorcetWinner(shared, arena);
+    if (winners==NULL)
+        winners = miniMaxCandidat(shared->duel, shared->duels, arena);
+    return winners;
+}
+
 /*******************
 *   RANKED PAIRS   *
 *******************/
 
 /**
- * @date 11/12/2023
- * @author Corentin LUDWIG
- * @brief trie la liste generique
- * @remark utilise le trie a bulle
+ * @date 16/10/2026
+ * @brief Moteur du rangement des paires : clôture transitive des paires verrouillées, une
+ * ligne de bits par candidat
  */
-void sortGenList(GenList* arcs){
-    int i, j;
-    Arc *a1,*a2;
-    int size = genListSize(arcs);
-    for (i = 0; i < size; i++) {
-        for (j = 0; j < size - i-1; j++) {
-            a1 = (Arc*)genListGet(arcs, j);
-            a2 = (Arc*)genListGet(arcs, j+1);
-            if (a1->weight < a2->weight) {
-                genListSet(arcs, (void*) a1, j+1);
-                genListSet(arcs, (void*) a2, j);
-            }
-        }
-    }
-}
+typedef struct s_ranked_pairs {
+    unsigned nb_cand;
+    unsigned nb_words;  /* nombre de mots de 64 bits d'une ligne */
+    uint64_t* reach;    /* ligne x : bits des candidats atteignables depuis x */
+} RankedPairs;
+
+/* mot et bit du candidat c dans une ligne de la clôture */
+#define RP_WORD(c) ((c) / 64)
+#define RP_BIT(c) ((uint64_t)1 << ((c) % 64))
 
 
 /**
- * @date 08/12/2023
- * @author Alina IVANOVA
- * @brief creation de list des arcs triés
+ * @date 16/10/2026
+ * @brief Crée le moteur du rangement des paires, sans aucune paire verrouillée
  */
-GenList* sortedArcsCreate(Duel* duel){
-    //creating a graph
-    int nb_cand = duelNbCandidat(duel) ;
-    GenList* arcs = createGenList(nb_cand*2);
-
-    for (int i = 0; i< nb_cand ; i++){
-        for (int j = i+1; j<nb_cand; j++){  
-            //adding the arc or duel to the graph
-            Arc* arc = malloc(sizeof(Arc));
-            int cand1_vs = duelGetValue(duel, i, j);
-            int cand2_vs = duelGetValue(duel, j, i);
-            if(cand1_vs>cand2_vs) {
-                arc->id_dest = j;
-                arc->id_src = i;
-                arc->weight = cand1_vs;
-                genListAdd(arcs, arc);
-            }
-            else if (cand2_vs > cand1_vs){
-                arc->id_dest = i;
-                arc->id_src = j;
-                arc->weight = cand2_vs;
-                genListAdd(arcs, arc);
-            }
-        }    
-    }
-    sortGenList(arcs);
-    return arcs;
+RankedPairs* createRankedPairs(unsigned nb_cand, Arena* arena){
+    RankedPairs* rp = memAlloc(arena, sizeof(RankedPairs));
+    rp->nb_cand = nb_cand;
+    rp->nb_words = (nb_cand + 63) / 64;
+    rp->reach = memCalloc(arena, nb_cand > 0 ? (size_t)nb_cand * rp->nb_words : 1, sizeof(uint64_t));
+    return rp;
 }
 
+
 /**
- * @date 11/12/2023
- * @author Alina IVANOVA
- * @brief creation d'un graphe sans cycles
+ * @date 16/10/2026
+ * @brief Supprime le moteur du rangement des paires
  */
-Graph* creatingGraph(Duel* duel){
-    int nb_cand = duelNbCandidat(duel) ;
-    GenList* labels_graph = createGenList(sizeof(char)*nb_cand);
-    for(int i = 0; i < nb_cand; i++){
-        genListAdd(labels_graph, duelIndexToLabel(duel, i));
-    }
+void deleteRankedPairs(RankedPairs** rp, Arena* arena){
+    memFree(arena, (*rp)->reach);
+    memFree(arena, *rp);
+    *rp = NULL;
+}
 
-    GenList* arcs_list = sortedArcsCreate(duel);
-    int nb_arcs = genListSize(arcs_list);
 
-    Graph* winner_graph = createGraph(nb_cand, labels_graph);
+/**
+ * @date 16/10/2026
+ * @brief Test si verrouiller la paire src -> dest crée un cycle (dest atteint déjà src)
+ */
+bool rankedPairsIsMakingCycle(RankedPairs* rp, unsigned src, unsigned dest){
+    return src == dest || (rp->reach[(size_t)dest * rp->nb_words + RP_WORD(src)] & RP_BIT(src)) != 0;
+}
 
-    while(!genListEmpty(labels_graph))
-        free(genListPop(labels_graph));
-    deleteGenList(&labels_graph);
 
-    for (int i = 0; i< nb_arcs; i++){
-        Arc* arc_current = genListGet(arcs_list, i);
-        if(!graphIsMakingCycle(winner_graph, arc_current)){
-            int src = arc_current->id_src;
-            int dest = arc_current->id_dest;
-            int weiht = arc_current->weight;
-            graphAdd(winner_graph,src ,dest , weiht);
-        }
+/**
+ * @date 16/10/2026
+ * @brief Verrouille la paire src -> dest : src et tous les candidats qui l'atteignent
+ * atteignent maintenant dest et tout ce que dest atteint
+ *
+ * @pre !rankedPairsIsMakingCycle(rp, src, dest)
+ */
+void rankedPairsLock(RankedPairs* rp, unsigned src, unsigned dest){
+    unsigned nb_words = rp->nb_words;
+    const uint64_t* row_dest = rp->reach + (size_t)dest * nb_words;
+    uint64_t* row = rp->reach + (size_t)src * nb_words;
+
+    /* src atteint déjà dest : la clôture ne change pas */
+    if(row[RP_WORD(dest)] & RP_BIT(dest)) return;
+
+    for(unsigned u = 0; u < rp->nb_cand; u++){
+        row = rp->reach + (size_t)u * nb_words;
+        if(u != src && !(row[RP_WORD(src)] & RP_BIT(src))) continue;
+        for(unsigned w = 0; w < nb_words; w++)
+            row[w] |= row_dest[w];
+        row[RP_WORD(dest)] |= RP_BIT(dest);
     }
-    while(!genListEmpty(arcs_list))
-        free(genListPop(arcs_list));
-    deleteGenList(&arcs_list);
-
-    return winner_graph;
 }
 
 
@@ -223,29 +354,28 @@ Graph* creatingGraph(Duel* duel){
  * @date 11/12/2023
  * @author Alina IVANOVA
  * @brief creation d'un list des candidats gagnants
+ *
+ * @param[in] duel matrice des duels (labels des candidats)
+ * @param[in] arcs arcs triés par poids décroissant (voir @ref sortedArcsCreate)
+ * @param[in] nb_arcs nombre d'arcs
  */
-GenList* findWinnerGraph(Duel* duel){
-    Graph* graph = creatingGraph(duel);
-    GenList* arcs_sorted = graphToSortedList(graph, DESCENDING);
-
-
+GenList* findWinnerGraph(Duel* duel, const Arc* arcs, unsigned nb_arcs, Arena* arena){
     int nb_cand = duelNbCandidat(duel) ;
-    int nb_arcs = graphNbArc(graph);
     int wins_arcs[nb_cand];
-
-    deleteGraph(&graph);
+    RankedPairs* ranked_pairs = createRankedPairs(nb_cand, arena);
 
     for(int i = 0; i<nb_cand; i++) wins_arcs[i] = 0;
-    Arc* arc_current;
-    int src_id;
-    for(int i = 0; i<nb_arcs; i++){
-        arc_current =(Arc*) genListGet(arcs_sorted, i);
-        src_id = arc_current->id_src;
-        wins_arcs[src_id]++;
+
+    /* verrouillage des paires par ordre décroissant, sauf celles qui créent un cycle */
+    const Arc* arc_current;
+    for(unsigned i = 0; i<nb_arcs; i++){
+        arc_current = &arcs[i];
+        if(!rankedPairsIsMakingCycle(ranked_pairs, arc_current->id_src, arc_current->id_dest)){
+            rankedPairsLock(ranked_pairs, arc_current->id_src, arc_current->id_dest);
+            wins_arcs[arc_current->id_src]++;
+        }
     }
-    while(!genListEmpty(arcs_sorted))
-        free(genListPop(arcs_sorted));
-    deleteGenList(&arcs_sorted);
+    deleteRankedPairs(&ranked_pairs, arena);
     
     int max_winnings = 0;
     
@@ -253,25 +383,19 @@ GenList* findWinnerGraph(Duel* duel){
 
     for(int i = 0; i < nb_cand; i++){
         if(wins_arcs[i]>max_winnings){
-            while(genListSize(winners)!=0) free((WinnerCondorcet*)genListPop(winners));
+            while(genListSize(winners)!=0) memFree(arena, genListPop(winners));
             max_winnings = wins_arcs[i];
             
-            WinnerCondorcet* cand_possible = malloc(sizeof(WinnerCondorcet));
+            WinnerCondorcet* cand_possible = memAlloc(arena, sizeof(WinnerCondorcet));
             cand_possible->score = max_winnings;
-            char* winner_name =  duelIndexToLabel(duel, i);
-            strncpy(cand_possible->name, winner_name, MAX_LENGHT_LABEL);
-            
-            free(winner_name);
+            strncpy(cand_possible->name, duelIndexToLabel(duel, i), MAX_LENGHT_LABEL);
             genListAdd(winners, cand_possible);
         }
         else if(wins_arcs[i]==max_winnings){
-            WinnerCondorcet* another_cand = malloc(sizeof(WinnerCondorcet));
+            WinnerCondorcet* another_cand = memAlloc(arena, sizeof(WinnerCondorcet));
             
             another_cand->score = max_winnings;
-            char* winner_name =  duelIndexToLabel(duel, i);
-            strncpy(another_cand->name, winner_name, MAX_LENGHT_LABEL);
-            
-            free(winner_name);
+            strncpy(another_cand->name, duelIndexToLabel(duel, i), MAX_LENGHT_LABEL);
             genListAdd(winners, another_cand);
         }
     }
@@ -293,14 +417,18 @@ GenList* findWinnerGraph(Duel* duel){
  *
  * @return Le gagnant en utilisant la structure WinnerCondorcet.
 */
-GenList* theWinnerRankedPairs(Duel* duel){
+GenList* theWinnerRankedPairsArena(Duel* duel, Arena* arena){
     GenList* winners;
 
-    WinnerCondorcet* winner = CondorcetWinnerCriterion(duel);
+    WinnerCondorcet* winner = CondorcetWinnerCriterionArena(duel, arena);
 
     if (winner==NULL) {
-        free(winner);
-        winners = findWinnerGraph(duel);
+        unsigned nb_arcs;
+        int* duels = duelsFlatten(duel, arena);
+        Arc* arcs = sortedArcsCreate(duels, duelNbCandidat(duel), &nb_arcs, arena);
+        memFree(arena, duels);
+        winners = findWinnerGraph(duel, arcs, nb_arcs, arena);
+        memFree(arena, arcs);
     }
     else {
         winners = createGenList(1);
@@ -311,190 +439,219 @@ GenList* theWinnerRankedPairs(Duel* duel){
 }
 
 
-/**************
-*   SCHULZE   *
-**************/
-
-
 /**
- * @date 16/12/2023
- * @author Alina IVANOVA
- * @brief retourne la valeur maximale
+ * @date 16/10/2026
+ * @brief theWinnerRankedPairsArena sans arène : le résultat est alloué avec malloc
  */
-int max(int a, int b) {
-    return (a > b) ? a : b;
+GenList* theWinnerRankedPairs(Duel* duel){
+    return theWinnerRankedPairsArena(duel, NULL);
 }
 
+
 /**
- * @date 16/12/2023
- * @author Alina IVANOVA
- * @brief retourne la valeur minimale
+ * @date 16/10/2026
  */
-int min(int a, int b) {
-    return (a < b) ? a : b;
+GenList* theWinnerRankedPairsShared(CondorcetShared* shared, Arena* arena){
+    GenList* winners = sharedCondorcetWinner(shared, arena);
+    if (winners==NULL)
+        winners = findWinnerGraph(shared->duel, shared->arcs, shared->nb_arcs, arena);
+    return winners;
 }
 
 
-/**
- * @date 16/12/2023
- * @author Alina IVANOVA
- * @brief creation des arcs à partir des duel, le gagnant a le valeur de duel comme un weight et son adversaire a 0
- */
-GenList* arcsCreate(Duel* duel){
-    //creating a graph
-    int nb_cand = duelNbCandidat(duel) ;
-    GenList* arcs = createGenList(nb_cand*(nb_cand-1));
+/**************
+*   SCHULZE   *
+**************/
 
-    for ( int i = 0; i< nb_cand ; i++){
-        for ( int j = i+1; j<nb_cand; j++){  
-            //adding the arc or duel to the graph
-            Arc* arc = malloc(sizeof(Arc));
-            Arc* arc_inverse = malloc(sizeof(Arc));
-            int cand1_vs = duelGetValue(duel, i, j);
-            int cand2_vs = duelGetValue(duel, j, i);
 
-            if(cand1_vs>cand2_vs) {
-                arc->id_dest = j;
-                arc->id_src = i;
-                arc->weight = cand1_vs;
+/* taille (en candidats) des blocs du calcul des chemins : 3 blocs de 64x64 int tiennent en cache L1/L2 */
+#define SCHULZE_BLOCK 64
+/* nombre minimum de lignes de la matrice des chemins traitées par chaque thread */
+#define SCHULZE_MIN_ROWS_PER_THREAD 16
+
 
-                arc_inverse->id_dest = i;
-                arc_inverse->id_src = j;
-                arc_inverse->weight = 0;
+/**
+ * @date 16/10/2026
+ * @brief Matrice plate (nb_cand x nb_cand) des arcs du graphe de Schulze : le gagnant d'un
+ * duel a la valeur du duel comme poids et son adversaire 0 (égalité : le second candidat gagne)
+ *
+ * @param[in] duels matrice plate des duels (voir @ref duelsFlatten)
+ * @param[in] nb_cand nombre de candidats
+ *
+ * @return tableau paths, paths[i*nb_cand+j] = poids de l'arc i -> j (à libérer)
+ */
+int* schulzeMargins(const int* duels, unsigned nb_cand, Arena* arena){
+    int* paths = memAlloc(arena, sizeof(int)*(nb_cand > 0 ? (size_t)nb_cand*nb_cand : 1));
+    int cand1_vs, cand2_vs;
+
+    for(unsigned i = 0; i < nb_cand; i++){
+        paths[(size_t)i*nb_cand + i] = 0;
+        for(unsigned j = i+1; j < nb_cand; j++){
+            cand1_vs = duels[(size_t)i*nb_cand + j];
+            cand2_vs = duels[(size_t)j*nb_cand + i];
+            if(cand1_vs > cand2_vs) {
+                paths[(size_t)i*nb_cand + j] = cand1_vs;
+                paths[(size_t)j*nb_cand + i] = 0;
+            } else {
+                paths[(size_t)j*nb_cand + i] = cand2_vs;
+                paths[(size_t)i*nb_cand + j] = 0;
             }
-            else {
-                arc->id_dest = i;
-                arc->id_src = j;
-                arc->weight = cand2_vs;
-
-                arc_inverse->id_dest = j;
-                arc_inverse->id_src = i;
-                arc_inverse->weight = 0;
-            } 
-            genListAdd(arcs, arc);
-            genListAdd(arcs, arc_inverse);
-        }    
+        }
     }
-
-    return arcs;
+    return paths;
 }
 
 
-
 /**
- * @date 16/12/2023
- * @author Alina IVANOVA
- * @brief creation d'un graphe à partir de duel
+ * @date 16/10/2026
+ * @brief Relâche les lignes [i_begin, i_end[ du bloc de colonnes jb par les candidats
+ * intermédiaires du bloc kb : paths[i][j] = max(paths[i][j], min(paths[i][k], paths[k][j]))
+ *
+ * @param[in,out] paths matrice plate des chemins
+ * @param[in] nb_cand nombre de candidats
+ * @param[in] i_begin première ligne (candidat source)
+ * @param[in] i_end fin (exclue) des lignes
+ * @param[in] jb premier candidat destination du bloc
+ * @param[in] kb premier candidat intermédiaire du bloc
  */
-
-Graph* graphCreate(Duel* duel){
-    int nb_cand = duelNbCandidat(duel) ;
-    GenList* labels_graph = createGenList(sizeof(char)*nb_cand);
-    for(int i = 0; i < nb_cand; i++){
-        genListAdd(labels_graph, duelIndexToLabel(duel, i));
-    }
-
-    Graph* winner_graph = createGraph(nb_cand, labels_graph);
-
-    GenList* arcs_list = arcsCreate(duel);
-
-    for (int i = 0; i< nb_cand*(nb_cand-1); i++){
-        Arc* arc_current = genListGet(arcs_list, i);
-        graphAdd(winner_graph,arc_current->id_src ,arc_current->id_dest , arc_current->weight);
+void schulzeBlock(int* paths, unsigned nb_cand, unsigned i_begin, unsigned i_end, unsigned jb, unsigned kb){
+    unsigned j_end = jb + SCHULZE_BLOCK < nb_cand ? jb + SCHULZE_BLOCK : nb_cand;
+    unsigned k_end = kb + SCHULZE_BLOCK < nb_cand ? kb + SCHULZE_BLOCK : nb_cand;
+    int *row_i, *row_k;
+    int path_ik, via_k;
+
+    for(unsigned k = kb; k < k_end; k++){
+        row_k = paths + (size_t)k*nb_cand;
+        for(unsigned i = i_begin; i < i_end; i++){
+            row_i = paths + (size_t)i*nb_cand;
+            path_ik = row_i[k];
+            /* boucle sans branchement (vectorisable) */
+            for(unsigned j = jb; j < j_end; j++){
+                via_k = path_ik < row_k[j] ? path_ik : row_k[j];
+                row_i[j] = row_i[j] > via_k ? row_i[j] : via_k;
+            }
+        }
     }
-
-    while(!genListEmpty(labels_graph))
-        free(genListPop(labels_graph));
-    deleteGenList(&labels_graph);
-
-    while(!genListEmpty(arcs_list))
-        free(genListPop(arcs_list));
-    deleteGenList(&arcs_list);
-
-    return winner_graph;
 }
 
 
+/**
+ * @date 16/10/2026
+ * @brief Contexte du calcul parallèle des chemins pour un bloc de candidats intermédiaires
+ */
+typedef struct s_schulze_parallel {
+    int* paths;         /* matrice plate des chemins */
+    unsigned nb_cand;   /* nombre de candidats */
+    unsigned kb;        /* premier candidat du bloc intermédiaire courant */
+} SchulzeParallel;
 
 
 /**
- * @date 16/12/2023
- * @author Alina IVANOVA
- * @brief modification de graph pour que le weight = le chemin entre source et destination
+ * @date 16/10/2026
+ * @brief Relâche la ligne et la colonne de blocs kb, réparties par blocs entre les threads
+ * (fonction de thread)
  */
+void schulzeCrossThread(unsigned id, unsigned nb_threads, void* arg){
+    SchulzeParallel* sp = (SchulzeParallel*)arg;
+    unsigned nb_blocks = (sp->nb_cand + SCHULZE_BLOCK - 1) / SCHULZE_BLOCK;
+    unsigned kb = sp->kb, k_end = kb + SCHULZE_BLOCK < sp->nb_cand ? kb + SCHULZE_BLOCK : sp->nb_cand;
+    unsigned begin, end, b, b_end;
+
+    parallelSplit(nb_blocks, id, nb_threads, &begin, &end);
+    for(unsigned block = begin; block < end; block++){
+        b = block * SCHULZE_BLOCK;
+        if(b == kb) continue;
+        b_end = b + SCHULZE_BLOCK < sp->nb_cand ? b + SCHULZE_BLOCK : sp->nb_cand;
+        schulzeBlock(sp->paths, sp->nb_cand, kb, k_end, b, kb);
+        schulzeBlock(sp->paths, sp->nb_cand, b, b_end, kb, kb);
+    }
+}
 
-Graph* findingPaths(Duel* duel){
-    Graph* graph_for_search = graphCreate(duel);
-    int nb_cand = duelNbCandidat(duel);
-    int cand_2vs1, cand_3vs1, cand_2vs3;
 
-    for(int cand_3 = 0; cand_3<nb_cand; cand_3++){
-        for(int cand_2 = 0;cand_2<nb_cand; cand_2++){
-            
-            if (cand_2!=cand_3){
-                for(int cand_1 = 0; cand_1 < nb_cand; cand_1++){
-                    
-                    if(cand_3!=cand_1 && cand_1!=cand_2){
-
-                        cand_2vs1 = graphGetWeight(graph_for_search, cand_2, cand_1);
-                        cand_2vs3 = graphGetWeight(graph_for_search, cand_2, cand_3);
-                        cand_3vs1 = graphGetWeight(graph_for_search, cand_3, cand_1);
-                        
-                        int weight = max(cand_2vs1, min(cand_2vs3, cand_3vs1));
-
-                        graphSetWeight(graph_for_search, cand_2, cand_1, weight);
-                    }
-                }
-            } 
+/**
+ * @date 16/10/2026
+ * @brief Relâche les blocs hors de la ligne et de la colonne kb, les lignes sont réparties
+ * entre les threads (fonction de thread)
+ */
+void schulzeRestThread(unsigned id, unsigned nb_threads, void* arg){
+    SchulzeParallel* sp = (SchulzeParallel*)arg;
+    unsigned kb = sp->kb, k_end = kb + SCHULZE_BLOCK < sp->nb_cand ? kb + SCHULZE_BLOCK : sp->nb_cand;
+    unsigned begin, end, i_end;
+
+    parallelSplit(sp->nb_cand, id, nb_threads, &begin, &end);
+    /* lignes du thread par paquets de SCHULZE_BLOCK, sans les lignes du bloc kb */
+    for(unsigned i = begin; i < end; i = i_end){
+        if(i >= kb && i < k_end) {
+            i_end = k_end < end ? k_end : end;
+            continue;
         }
+        i_end = i + SCHULZE_BLOCK < end ? i + SCHULZE_BLOCK : end;
+        if(i < kb && i_end > kb) i_end = kb;
+        for(unsigned jb = 0; jb < sp->nb_cand; jb += SCHULZE_BLOCK)
+            if(jb != kb)
+                schulzeBlock(sp->paths, sp->nb_cand, i, i_end, jb, kb);
     }
-    return graph_for_search;
 }
 
 
-
 /**
- * @date 16/12/2023
- * @author Alina IVANOVA
- * @brief creation d'un duel à partir d'une graphe des chemins
+ * @date 16/10/2026
+ * @brief Remplace le poids des arcs par la force du chemin le plus fort entre chaque paire de
+ * candidats (Floyd-Warshall par blocs, sur nb_threads threads)
+ *
+ * Pour chaque bloc de candidats intermédiaires kb : le bloc diagonal, puis la ligne et la colonne
+ * de blocs kb, puis les autres blocs qui ne dépendent que des précédents. Chaque étape écrit des
+ * blocs disjoints et ne lit que des blocs terminés : elle est répartie entre les threads.
+ *
+ * @param[in,out] paths matrice plate des arcs (voir @ref schulzeMargins)
+ * @param[in] nb_cand nombre de candidats
+ * @param[in] nb_threads nombre de threads
+ * @pre 1 <= nb_threads <= @ref PARALLEL_MAX_THREADS
+ *
+ * @note la diagonale est modifiée mais n'intervient pas dans les autres chemins
  */
-
-Duel* createDuelfromGraph(Graph* graph){
-    int nb_cand = graphNbVertex(graph);
-    GenList* labels = createGenList(nb_cand);
-    for (int i = 0 ; i<nb_cand; i++){
-        genListAdd(labels, graphGetLabel(graph, i));
+void schulzeWidestPathsParallel(int* paths, unsigned nb_cand, unsigned nb_threads){
+    SchulzeParallel sp = {paths, nb_cand, 0};
+
+    for(unsigned kb = 0; kb < nb_cand; kb += SCHULZE_BLOCK){
+        sp.kb = kb;
+        schulzeBlock(paths, nb_cand, kb, kb + SCHULZE_BLOCK < nb_cand ? kb + SCHULZE_BLOCK : nb_cand, kb, kb);
+        parallelRun(schulzeCrossThread, nb_threads, &sp);
+        parallelRun(schulzeRestThread, nb_threads, &sp);
     }
+}
 
-    Duel* duel = createDuel(nb_cand, labels);
-    for(int cand = 0; cand< nb_cand; cand++){
-        for(int cand_2 = cand+1 ; cand_2 < nb_cand; cand_2++){
-            duelSetValue(duel, cand, cand_2, graphGetWeight(graph, cand, cand_2));
-            duelSetValue(duel, cand_2, cand , graphGetWeight(graph, cand_2, cand));
-        }
-    }
 
-    while(!genListEmpty(labels))
-        free(genListPop(labels));
-    deleteGenList(&labels);
+/**
+ * @date 16/10/2026
+ * @brief Remplace le poids des arcs par la force du chemin le plus fort entre chaque paire de
+ * candidats, sur au plus @ref parallelNbThreads threads
+ *
+ * @param[in,out] paths matrice plate des arcs (voir @ref schulzeMargins)
+ * @param[in] nb_cand nombre de candidats
+ */
+void schulzeWidestPaths(int* paths, unsigned nb_cand){
+    unsigned nb_threads = parallelNbThreads();
+    unsigned max_threads = nb_cand / SCHULZE_MIN_ROWS_PER_THREAD;
+    if(max_threads < nb_threads)
+        nb_threads = max_threads < 1 ? 1 : max_threads;
 
-    return duel;
+    schulzeWidestPathsParallel(paths, nb_cand, nb_threads);
 }
 
 
 /**
  * @date 16/12/2023
  * @author Alina IVANOVA
- * @brief creation d'un genlist de(s) gagnat(s) à partir d'un duel des chemins
+ * @brief creation d'un genlist de(s) gagnat(s) à partir des chemins les plus forts
+ *
+ * @param[in] duel matrice des duels (labels des candidats)
+ * @param[in] duels matrice plate des duels (voir @ref duelsFlatten)
  */
-GenList* findWinnerGraphPath(Duel* duel){
-    Graph* graph_path = findingPaths(duel);
-    Duel* duel_path = createDuelfromGraph(graph_path);
-
-
-    deleteGraph(&graph_path);
-
+GenList* findWinnerGraphPath(Duel* duel, const int* duels, Arena* arena){
     int nb_cand= duelNbCandidat(duel);
+    int* paths = schulzeMargins(duels, nb_cand, arena);
+    schulzeWidestPaths(paths, nb_cand);
 
     GenList* candidates = createGenList(1);
     int max_wins = 0;
@@ -502,37 +659,31 @@ GenList* findWinnerGraphPath(Duel* duel){
         int winsCandidate = 0;
         
         for (int cand_2 = 0; cand_2 < nb_cand; cand_2++){
-            int win = duelGetValue(duel_path, cand_1, cand_2); 
-            int loss = duelGetValue(duel_path, cand_2, cand_1); 
+            int win = paths[cand_1*nb_cand + cand_2];
+            int loss = paths[cand_2*nb_cand + cand_1];
             if(win >= loss)winsCandidate++;
         }
 
         if (max_wins<winsCandidate){
-           while(genListSize(candidates)!=0) free((WinnerCondorcet*)genListPop(candidates));
+           while(genListSize(candidates)!=0) memFree(arena, genListPop(candidates));
             max_wins = winsCandidate;
             
-            WinnerCondorcet* cand_possible = malloc(sizeof(WinnerCondorcet));
+            WinnerCondorcet* cand_possible = memAlloc(arena, sizeof(WinnerCondorcet));
             
             cand_possible->score = winsCandidate;
-            char* winner_name =  duelIndexToLabel(duel_path, cand_1);
-            strncpy(cand_possible->name, winner_name, MAX_LENGHT_LABEL);
-            
-            free(winner_name);
+            strncpy(cand_possible->name, duelIndexToLabel(duel, cand_1), MAX_LENGHT_LABEL);
             genListAdd(candidates, cand_possible);
         }
         else if (max_wins == winsCandidate) {
-            WinnerCondorcet* cand_possible = malloc(sizeof(WinnerCondorcet));
+            WinnerCondorcet* cand_possible = memAlloc(arena, sizeof(WinnerCondorcet));
             
             cand_possible->score = winsCandidate;
-            char* winner_name =  duelIndexToLabel(duel_path, cand_1);
-            strncpy(cand_possible->name, winner_name, MAX_LENGHT_LABEL);
-            
-            free(winner_name);
+            strncpy(cand_possible->name, duelIndexToLabel(duel, cand_1), MAX_LENGHT_LABEL);
             genListAdd(candidates, cand_possible);
         }
     }
 
-    deleteDuel(&duel_path);
+    memFree(arena, paths);
 
     return candidates;
 
@@ -548,15 +699,37 @@ GenList* findWinnerGraphPath(Duel* duel){
  *
  * @return Le gagnant en utilisant la structure WinnerCondorcet.
 */
-GenList* theWinnerSchulze(Duel* duel){
+GenList* theWinnerSchulzeArena(Duel* duel, Arena* arena){
     GenList* winners;
-    WinnerCondorcet* winner_condorcet = CondorcetWinnerCriterion(duel);
+    WinnerCondorcet* winner_condorcet = CondorcetWinnerCriterionArena(duel, arena);
     if (winner_condorcet==NULL) {
-        winners = findWinnerGraphPath(duel);
+        int* duels = duelsFlatten(duel, arena);
+        winners = findWinnerGraphPath(duel, duels, arena);
+        memFree(arena, duels);
     }
     else {
         winners = createGenList(1);
         genListAdd(winners,winner_condorcet);
     }
     return winners;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief theWinnerSchulzeArena sans arène : le résultat est alloué avec malloc
+ */
+GenList* theWinnerSchulze(Duel* duel){
+    return theWinnerSchulzeArena(duel, NULL);
+}
+
+
+/**
+ * @date 16/10/2026
+ */
+GenList* theWinnerSchulzeShared(CondorcetShared* shared, Arena* arena){
+    GenList* winners = sharedCondorcetWinner(shared, arena);
+    if (winners==NULL)
+        winners = findWinnerGraphPath(shared->duel, shared->duels, arena);
+    return winners;
 }
\ No newline at end of file
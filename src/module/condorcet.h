@@ -23,7 +23,9 @@
 #include <stdbool.h>
 #include <errno.h>
 #include "../structure/duel.h"
+#include "../structure/graph.h"
 #include "../structure/data_struct_utils.h"
+#include "../utils/arena.h"
 
 
 /*------------------------------------------------------------------*/
@@ -48,6 +50,97 @@ typedef struct s_winner_condorcet {
 */
 WinnerCondorcet* CondorcetWinnerCriterion(Duel* duel);
 
+/**
+ * @date 16/10/2026
+ * @brief Méthode vainqueur de Condorcet dont le vainqueur et les objets temporaires sont alloués dans une arène
+ *
+ * @param[in] duel matrice des duels entre tous le candidats
+ * @param[in] arena arène des allocations (NULL : malloc, comme la version sans arène)
+ *
+ * @return Le gagnant (WinnerCondorcet) alloué dans l'arène, NULL s'il n'y a pas de vainqueur
+ * @note Avec une arène, seule la liste (GenList) est à supprimer, les gagnants sont
+ * libérés avec l'arène
+*/
+WinnerCondorcet* CondorcetWinnerCriterionArena(Duel* duel, Arena* arena);
+
+
+/**
+ * @date 16/10/2026
+ * @brief Prétraitement de la matrice des duels partagé par les méthodes de Condorcet
+ */
+typedef struct s_condorcet_shared {
+    Duel* duel;                 /* matrice des duels (prêtée, labels des gagnants) */
+    WinnerCondorcet* winner;    /* vainqueur de Condorcet, NULL s'il n'y en a pas */
+    int* duels;                 /* matrice plate des duels, NULL s'il y a un vainqueur */
+    Arc* arcs;                  /* arcs triés par poids décroissant, NULL s'il y a un vainqueur */
+    unsigned nb_arcs;           /* nombre d'arcs */
+} CondorcetShared;
+typedef CondorcetShared* ptrCondorcetShared;
+
+/**
+ * @date 16/10/2026
+ * @brief Calcule une seule fois ce que les méthodes minimax, rangement des paires et Schulze
+ * extraient chacune de la matrice des duels : le vainqueur de Condorcet, la matrice plate des
+ * duels et la liste des arcs triés par poids décroissant
+ *
+ * @param[in] duel matrice des duels entre tous le candidats
+ * @param[in] arena arène des allocations (NULL : malloc)
+ * @pre duel != NULL
+ *
+ * @return le prétraitement, à passer aux fonctions theWinner*Shared
+ * @note La matrice des duels est prêtée : elle doit exister jusqu'à la suppression du prétraitement
+ * @note Le prétraitement n'est que lu par les méthodes : plusieurs méthodes peuvent s'exécuter
+ * en même temps sur le même prétraitement, chacune avec sa propre arène
+ */
+CondorcetShared* createCondorcetShared(Duel* duel, Arena* arena);
+
+/**
+ * @date 16/10/2026
+ * @brief Supprime un prétraitement partagé
+ *
+ * @param[in] shared prétraitement à supprimer
+ * @param[in] arena arène utilisée à la création du prétraitement
+ * @pre shared != NULL && *shared != NULL
+ * @post *shared == NULL
+ */
+void deleteCondorcetShared(ptrCondorcetShared* shared, Arena* arena);
+
+/**
+ * @date 16/10/2026
+ * @brief Copie la matrice des duels dans un tableau plat
+ *
+ * @param[in] duel matrice des duels entre tous le candidats
+ * @param[in] arena arène des allocations (NULL : malloc)
+ *
+ * @return tableau duels, duels[i*nb_cand+j] = duelGetValue(duel, i, j)
+ */
+int* duelsFlatten(Duel* duel, Arena* arena);
+
+/**
+ * @date 16/10/2026
+ * @brief Tableau des arcs des duels gagnés (les égalités n'en donnent pas), triés par poids
+ * décroissant
+ *
+ * @param[in] duels matrice plate des duels (voir @ref duelsFlatten)
+ * @param[in] nb_cand nombre de candidats
+ * @param[out] nb_arcs nombre d'arcs du tableau
+ * @param[in] arena arène des allocations (NULL : malloc)
+ *
+ * @return tableau des arcs
+ */
+Arc* sortedArcsCreate(const int* duels, unsigned nb_cand, unsigned* nb_arcs, Arena* arena);
+
+/**
+ * @date 16/10/2026
+ * @brief Liste contenant une copie du vainqueur de Condorcet du prétraitement
+ *
+ * @param[in] shared prétraitement de la matrice des duels
+ * @param[in] arena arène des allocations (NULL : malloc)
+ *
+ * @return la liste, NULL s'il n'y a pas de vainqueur de Condorcet
+ */
+GenList* sharedCondorcetWinner(CondorcetShared* shared, Arena* arena);
+
 
 /**
  * @author IVANOVA ALina 
@@ -60,6 +153,31 @@ WinnerCondorcet* CondorcetWinnerCriterion(Duel* duel);
 */
 GenList* theWinnerMinimax(Duel* duel);
 
+/**
+ * @date 16/10/2026
+ * @brief Méthode minimax dont les gagnants et les objets temporaires sont alloués dans une arène
+ *
+ * @param[in] duel matrice des duels entre tous le candidats
+ * @param[in] arena arène des allocations (NULL : malloc, comme la version sans arène)
+ *
+ * @return Liste des gagnants (WinnerCondorcet) alloués dans l'arène
+ * @note Avec une arène, seule la liste (GenList) est à supprimer, les gagnants sont
+ * libérés avec l'arène
+*/
+GenList* theWinnerMinimaxArena(Duel* duel, Arena* arena);
+
+/**
+ * @date 16/10/2026
+ * @brief Méthode minimax à partir du prétraitement partagé (voir @ref createCondorcetShared)
+ *
+ * @param[in] shared prétraitement de la matrice des duels
+ * @param[in] arena arène des allocations de la méthode (NULL : malloc)
+ *
+ * @return Liste des gagnants (WinnerCondorcet) alloués dans l'arène, identique à
+ * celle de @ref theWinnerMinimaxArena
+*/
+GenList* theWinnerMinimaxShared(CondorcetShared* shared, Arena* arena);
+
 
 /**
  * @author IVANOVA ALina 
@@ -72,6 +190,31 @@ GenList* theWinnerMinimax(Duel* duel);
 */
 GenList* theWinnerRankedPairs(Duel* duel);
 
+/**
+ * @date 16/10/2026
+ * @brief Méthode rangement des paires dont les gagnants et les objets temporaires sont alloués dans une arène
+ *
+ * @param[in] duel matrice des duels entre tous le candidats
+ * @param[in] arena arène des allocations (NULL : malloc, comme la version sans arène)
+ *
+ * @return Liste des gagnants (WinnerCondorcet) alloués dans l'arène
+ * @note Avec une arène, seule la liste (GenList) est à supprimer, les gagnants sont
+ * libérés avec l'arène
+*/
+GenList* theWinnerRankedPairsArena(Duel* duel, Arena* arena);
+
+/**
+ * @date 16/10/2026
+ * @brief Méthode rangement des paires à partir du prétraitement partagé (voir @ref createCondorcetShared)
+ *
+ * @param[in] shared prétraitement de la matrice des duels
+ * @param[in] arena arène des allocations de la méthode (NULL : malloc)
+ *
+ * @return Liste des gagnants (WinnerCondorcet) alloués dans l'arène, identique à
+ * celle de @ref theWinnerRankedPairsArena
+*/
+GenList* theWinnerRankedPairsShared(CondorcetShared* shared, Arena* arena);
+
 /**
  * @author IVANOVA ALina 
  * @date 04/11/2023
@@ -83,5 +226,30 @@ GenList* theWinnerRankedPairs(Duel* duel);
 */
 GenList* theWinnerSchulze(Duel* duel);
 
+/**
+ * @date 16/10/2026
+ * @brief Méthode Schulze dont les gagnants et les objets temporaires sont alloués dans une arène
+ *
+ * @param[in] duel matrice des duels entre tous le candidats
+ * @param[in] arena arène des allocations (NULL : malloc, comme la version sans arène)
+ *
+ * @return Liste des gagnants (WinnerCondorcet) alloués dans l'arène
+ * @note Avec une arène, seule la liste (GenList) est à supprimer, les gagnants sont
+ * libérés avec l'arène
+*/
+GenList* theWinnerSchulzeArena(Duel* duel, Arena* arena);
+
+/**
+ * @date 16/10/2026
+ * @brief Méthode Schulze à partir du prétraitement partagé (voir @ref createCondorcetShared)
+ *
+ * @param[in] shared prétraitement de la matrice des duels
+ * @param[in] arena arène des allocations de la méthode (NULL : malloc)
+ *
+ * @return Liste des gagnants (WinnerCondorcet) alloués dans l'arène, identique à
+ * celle de @ref theWinnerSchulzeArena
+*/
+GenList* theWinnerSchulzeShared(CondorcetShared* shared, Arena* arena);
+
 
 #endif
\ No newline at end of file
@@ -32,7 +32,7 @@
  *
  * @return Le gagnant en utilisant la structure WinnerCondorcet ou NULL s'il n'y a pas de vaiqueur
 */
-WinnerCondorcet* CondorcetWinnerCriterion(Duel* duel){
+WinnerCondorcet* CondorcetWinnerCriterionArena(Duel* duel, Arena* arena){
     int nbCandidats= duelNbCandidat(duel);
     int maxWins = 0;
     int winner = -1;
@@ -51,10 +51,139 @@ WinnerCondorcet* CondorcetWinnerCriterion(Duel* duel){
     }
 
     if (winner == -1) return NULL;
-    WinnerCondorcet* vainqueur = malloc(sizeof(WinnerCondorcet));
-    char* winner_name =  duelIndexToLabel(duel, winner);
-    strncpy(vainqueur->name, winner_name, 256);
-    free(winner_name);
+    WinnerCondorcet* vainqueur = memAlloc(arena, sizeof(WinnerCondorcet));
+    strncpy(vainqueur->name, duelIndexToLabel(duel, winner), 256);
     vainqueur->score = maxWins;
     return vainqueur;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief CondorcetWinnerCriterionArena sans arène : le résultat est alloué avec malloc
+ */
+WinnerCondorcet* CondorcetWinnerCriterion(Duel* duel){
+    return CondorcetWinnerCriterionArena(duel, NULL);
+}
+
+
+/****************************
+*   PRÉTRAITEMENT PARTAGÉ   *
+****************************/
+
+/**
+ * @date 16/10/2026
+ * @brief Copie la matrice des duels dans un tableau plat, lu sans appel de fonction par les méthodes
+ *
+ * @param[in] duel matrice des duels entre tous le candidats
+ *
+ * @return tableau duels, duels[i*nb_cand+j] = duelGetValue(duel, i, j) (à libérer)
+ */
+int* duelsFlatten(Duel* duel, Arena* arena){
+    unsigned nb_cand = duelNbCandidat(duel);
+    int* duels = memAlloc(arena, sizeof(int)*(nb_cand > 0 ? (size_t)nb_cand*nb_cand : 1));
+
+    for(unsigned i = 0; i < nb_cand; i++)
+        for(unsigned j = 0; j < nb_cand; j++)
+            duels[(size_t)i*nb_cand + j] = duelGetValue(duel, i, j);
+    return duels;
+}
+
+
+/**
+ * @date 08/12/2023
+ * @author Alina IVANOVA
+ * @brief creation du tableau des arcs triés par poids décroissant
+ *
+ * @param[in] duels matrice plate des duels (voir @ref duelsFlatten)
+ * @param[in] nb_cand nombre de candidats
+ * @param[out] nb_arcs nombre d'arcs du tableau
+ * @return tableau des arcs (à libérer avec free)
+ */
+Arc* sortedArcsCreate(const int* duels, unsigned nb_cand, unsigned* nb_arcs, Arena* arena){
+    Arc* arcs = memAlloc(arena, ((size_t)nb_cand * nb_cand / 2 + 1) * sizeof(Arc));
+    unsigned n = 0;
+
+    for (unsigned i = 0; i< nb_cand ; i++){
+        for (unsigned j = i+1; j<nb_cand; j++){  
+            //adding the arc or duel to the array
+            int cand1_vs = duels[(size_t)i*nb_cand + j];
+            int cand2_vs = duels[(size_t)j*nb_cand + i];
+            if(cand1_vs>cand2_vs) {
+                arcs[n].id_dest = j;
+                arcs[n].id_src = i;
+                arcs[n].weight = cand1_vs;
+                n++;
+            }
+            else if (cand2_vs > cand1_vs){
+                arcs[n].id_dest = i;
+                arcs[n].id_src = j;
+                arcs[n].weight = cand2_vs;
+                n++;
+            }
+        }    
+    }
+    /* tri stable : à poids égal, la paire (i, j), i < j, la plus petite passe en premier */
+    sortArcs(arcs, n, DESCENDING);
+    *nb_arcs = n;
+    return arcs;
+}
+
+
+/**
+ * @date 16/10/2026
+ */
+CondorcetShared* createCondorcetShared(Duel* duel, Arena* arena){
+#ifdef DEBUG
+    testArgNull(duel, "condorcet_criterion.c", "createCondorcetShared", "duel");
+#endif
+
+    CondorcetShared* shared = memAlloc(arena, sizeof(CondorcetShared));
+    shared->duel = duel;
+    shared->winner = CondorcetWinnerCriterionArena(duel, arena);
+    shared->duels = NULL;
+    shared->arcs = NULL;
+    shared->nb_arcs = 0;
+
+    /* avec un vainqueur de Condorcet, aucune méthode ne lit les duels */
+    if(shared->winner == NULL){
+        shared->duels = duelsFlatten(duel, arena);
+        shared->arcs = sortedArcsCreate(shared->duels, duelNbCandidat(duel), &shared->nb_arcs, arena);
+    }
+    return shared;
+}
+
+
+/**
+ * @date 16/10/2026
+ */
+void deleteCondorcetShared(ptrCondorcetShared* shared, Arena* arena){
+#ifdef DEBUG
+    testArgNull(shared, "condorcet_criterion.c", "deleteCondorcetShared", "shared");
+    testArgNull(*shared, "condorcet_criterion.c", "deleteCondorcetShared", "*shared");
+#endif
+
+    memFree(arena, (*shared)->winner);
+    memFree(arena, (*shared)->duels);
+    memFree(arena, (*shared)->arcs);
+    memFree(arena, *shared);
+    *shared = NULL;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Liste contenant une copie du vainqueur de Condorcet du prétraitement, allouée dans
+ * l'arène de la méthode
+ *
+ * @return la liste, NULL s'il n'y a pas de vainqueur de Condorcet
+ */
+GenList* sharedCondorcetWinner(CondorcetShared* shared, Arena* arena){
+    if(shared->winner == NULL) return NULL;
+
+    WinnerCondorcet* winner = memAlloc(arena, sizeof(WinnerCondorcet));
+    *winner = *shared->winner;
+    GenList* winners = createGenList(1);
+    genListAdd(winners, winner);
+    return winners;
 }
\ No newline at end of file
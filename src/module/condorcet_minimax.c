@@ -31,38 +31,37 @@
  * @author Alina IVANOVA
  * @date 20/11/2023 
  * @brief creation d'une liste avec le(s) gagnant(s) en utilisant la méthode Minimax
+ *
+ * @param[in] duel matrice des duels (labels des candidats)
+ * @param[in] duels matrice plate des duels (voir @ref duelsFlatten)
  */
-GenList* miniMaxCandidat(Duel* duel){
+GenList* miniMaxCandidat(Duel* duel, const int* duels, Arena* arena){
     int nbCandidats= duelNbCandidat(duel);
     int miniDifference;
     GenList* candidates = createGenList(1);
     for (int cand1 = 0; cand1<nbCandidats;cand1++){
         int maxDiffCandidat = 0;
         for (int cand2 = 0; cand2 < nbCandidats; cand2++){
-            int diff = duelGetValue(duel, cand2, cand1); 
+            int diff = duels[cand2*nbCandidats + cand1];
             if(diff > maxDiffCandidat){
                 maxDiffCandidat = diff;
             }
         }
         
         if (cand1 == 0 || miniDifference>maxDiffCandidat){
-            while(genListSize(candidates)!=0) free((WinnerCondorcet*)genListPop(candidates));
+            while(genListSize(candidates)!=0) memFree(arena, genListPop(candidates));
 
             miniDifference = maxDiffCandidat;
             
-            WinnerCondorcet* cand_possible = malloc(sizeof(WinnerCondorcet));
+            WinnerCondorcet* cand_possible = memAlloc(arena, sizeof(WinnerCondorcet));
             cand_possible->score = maxDiffCandidat;
-            char* winner_name =  duelIndexToLabel(duel, cand1);
-            strncpy(cand_possible->name, winner_name, MAX_LENGHT_LABEL);
-            free(winner_name);
+            strncpy(cand_possible->name, duelIndexToLabel(duel, cand1), MAX_LENGHT_LABEL);
             genListAdd(candidates, cand_possible);
         }
         else if(miniDifference == maxDiffCandidat){
-            WinnerCondorcet* another_cand = malloc(sizeof(WinnerCondorcet));
+            WinnerCondorcet* another_cand = memAlloc(arena, sizeof(WinnerCondorcet));
             another_cand->score = maxDiffCandidat;
-            char* winner_name =  duelIndexToLabel(duel, cand1);
-            strncpy(another_cand->name, winner_name, MAX_LENGHT_LABEL);
-            free(winner_name);
+            strncpy(another_cand->name, duelIndexToLabel(duel, cand1), MAX_LENGHT_LABEL);
             genListAdd(candidates, another_cand);
         }
     }
@@ -73,17 +72,39 @@ GenList* miniMaxCandidat(Duel* duel){
  * @author Alina IVANOVA
  * @date 20/11/2023 
  */
-GenList* theWinnerMinimax(Duel* duel){
+GenList* theWinnerMinimaxArena(Duel* duel, Arena* arena){
     GenList* winners;
     WinnerCondorcet* wtmp;
 
-    wtmp = CondorcetWinnerCriterion(duel);
+    wtmp = CondorcetWinnerCriterionArena(duel, arena);
     if (wtmp==NULL) {
-        winners = miniMaxCandidat(duel);
+        int* duels = duelsFlatten(duel, arena);
+        winners = miniMaxCandidat(duel, duels, arena);
+        memFree(arena, duels);
     }
     else {
         winners = createGenList(1);
         genListAdd(winners,wtmp);
     }
     return winners;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief theWinnerMinimaxArena sans arène : le résultat est alloué avec malloc
+ */
+GenList* theWinnerMinimax(Duel* duel){
+    return theWinnerMinimaxArena(duel, NULL);
+}
+
+
+/**
+ * @date 16/10/2026
+ */
+GenList* theWinnerMinimaxShared(CondorcetShared* shared, Arena* arena){
+    GenList* winners = sharedCondorcetWinner(shared, arena);
+    if (winners==NULL)
+        winners = miniMaxCandidat(shared->duel, shared->duels, arena);
+    return winners;
 }
\ No newline at end of file
@@ -22,6 +22,7 @@
 #include "../structure/duel.h"
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 #include <malloc.h>
 #include "../structure/genericlist.h"
 #include "../structure/graph.h"
@@ -30,97 +31,76 @@
 
 
 /**
- * @date 11/12/2023
- * @author Corentin LUDWIG
- * @brief trie la liste generique
- * @remark utilise le trie a bulle
+ * @date 16/10/2026
+ * @brief Moteur du rangement des paires : clôture transitive des paires verrouillées, une
+ * ligne de bits par candidat
  */
-void sortGenList(GenList* arcs){
-    int i, j;
-    Arc *a1,*a2;
-    int size = genListSize(arcs);
-    for (i = 0; i < size; i++) {
-        for (j = 0; j < size - i-1; j++) {
-            a1 = (Arc*)genListGet(arcs, j);
-            a2 = (Arc*)genListGet(arcs, j+1);
-            if (a1->weight < a2->weight) {
-                genListSet(arcs, (void*) a1, j+1);
-                genListSet(arcs, (void*) a2, j);
-            }
-        }
-    }
-}
+typedef struct s_ranked_pairs {
+    unsigned nb_cand;
+    unsigned nb_words;  /* nombre de mots de 64 bits d'une ligne */
+    uint64_t* reach;    /* ligne x : bits des candidats atteignables depuis x */
+} RankedPairs;
+
+/* mot et bit du candidat c dans une ligne de la clôture */
+#define RP_WORD(c) ((c) / 64)
+#define RP_BIT(c) ((uint64_t)1 << ((c) % 64))
 
 
 /**
- * @date 08/12/2023
- * @author Alina IVANOVA
- * @brief creation de list des arcs triés
+ * @date 16/10/2026
+ * @brief Crée le moteur du rangement des paires, sans aucune paire verrouillée
  */
-GenList* sortedArcsCreate(Duel* duel){
-    //creating a graph
-    int nb_cand = duelNbCandidat(duel) ;
-    GenList* arcs = createGenList(nb_cand*2);
-
-    for (int i = 0; i< nb_cand ; i++){
-        for (int j = i+1; j<nb_cand; j++){  
-            //adding the arc or duel to the graph
-            Arc* arc = malloc(sizeof(Arc));
-            int cand1_vs = duelGetValue(duel, i, j);
-            int cand2_vs = duelGetValue(duel, j, i);
-            if(cand1_vs>cand2_vs) {
-                arc->id_dest = j;
-                arc->id_src = i;
-                arc->weight = cand1_vs;
-                genListAdd(arcs, arc);
-            }
-            else if (cand2_vs > cand1_vs){
-                arc->id_dest = i;
-                arc->id_src = j;
-                arc->weight = cand2_vs;
-                genListAdd(arcs, arc);
-            }
-        }    
-    }
-    sortGenList(arcs);
-    return arcs;
+RankedPairs* createRankedPairs(unsigned nb_cand, Arena* arena){
+    RankedPairs* rp = memAlloc(arena, sizeof(RankedPairs));
+    rp->nb_cand = nb_cand;
+    rp->nb_words = (nb_cand + 63) / 64;
+    rp->reach = memCalloc(arena, nb_cand > 0 ? (size_t)nb_cand * rp->nb_words : 1, sizeof(uint64_t));
+    return rp;
 }
 
+
 /**
- * @date 11/12/2023
- * @author Alina IVANOVA
- * @brief creation d'un graphe sans cycles
+ * @date 16/10/2026
+ * @brief Supprime le moteur du rangement des paires
  */
-Graph* creatingGraph(Duel* duel){
-    int nb_cand = duelNbCandidat(duel) ;
-    GenList* labels_graph = createGenList(sizeof(char)*nb_cand);
-    for(int i = 0; i < nb_cand; i++){
-        genListAdd(labels_graph, duelIndexToLabel(duel, i));
-    }
+void deleteRankedPairs(RankedPairs** rp, Arena* arena){
+    memFree(arena, (*rp)->reach);
+    memFree(arena, *rp);
+    *rp = NULL;
+}
 
-    GenList* arcs_list = sortedArcsCreate(duel);
-    int nb_arcs = genListSize(arcs_list);
 
-    Graph* winner_graph = createGraph(nb_cand, labels_graph);
+/**
+ * @date 16/10/2026
+ * @brief Test si verrouiller la paire src -> dest crée un cycle (dest atteint déjà src)
+ */
+bool rankedPairsIsMakingCycle(RankedPairs* rp, unsigned src, unsigned dest){
+    return src == dest || (rp->reach[(size_t)dest * rp->nb_words + RP_WORD(src)] & RP_BIT(src)) != 0;
+}
 
-    while(!genListEmpty(labels_graph))
-        free(genListPop(labels_graph));
-    deleteGenList(&labels_graph);
 
-    for (int i = 0; i< nb_arcs; i++){
-        Arc* arc_current = genListGet(arcs_list, i);
-        if(!graphIsMakingCycle(winner_graph, arc_current)){
-            int src = arc_current->id_src;
-            int dest = arc_current->id_dest;
-            int weiht = arc_current->weight;
-            graphAdd(winner_graph,src ,dest , weiht);
-        }
+/**
+ * @date 16/10/2026
+ * @brief Verrouille la paire src -> dest : src et tous les candidats qui l'atteignent
+ * atteignent maintenant dest et tout ce que dest atteint
+ *
+ * @pre !rankedPairsIsMakingCycle(rp, src, dest)
+ */
+void rankedPairsLock(RankedPairs* rp, unsigned src, unsigned dest){
+    unsigned nb_words = rp->nb_words;
+    const uint64_t* row_dest = rp->reach + (size_t)dest * nb_words;
+    uint64_t* row = rp->reach + (size_t)src * nb_words;
+
+    /* src atteint déjà dest : la clôture ne change pas */
+    if(row[RP_WORD(dest)] & RP_BIT(dest)) return;
+
+    for(unsigned u = 0; u < rp->nb_cand; u++){
+        row = rp->reach + (size_t)u * nb_words;
+        if(u != src && !(row[RP_WORD(src)] & RP_BIT(src))) continue;
+        for(unsigned w = 0; w < nb_words; w++)
+            row[w] |= row_dest[w];
+        row[RP_WORD(dest)] |= RP_BIT(dest);
     }
-    while(!genListEmpty(arcs_list))
-        free(genListPop(arcs_list));
-    deleteGenList(&arcs_list);
-
-    return winner_graph;
 }
 
 
@@ -128,40 +108,37 @@ Graph* creatingGraph(Duel* duel){
  * @date 11/12/2023
  * @author Alina IVANOVA
  * @brief creation d'un list des candidats gagnants
+ *
+ * @param[in] duel matrice des duels (labels des candidats)
+ * @param[in] arcs arcs triés par poids décroissant (voir @ref sortedArcsCreate)
+ * @param[in] nb_arcs nombre d'arcs
  */
-GenList* findWinnerGraph(Duel* duel){
-    Graph* graph = creatingGraph(duel);
-    GenList* arcs_sorted = graphToSortedList(graph, DESCENDING);
-
-
+GenList* findWinnerGraph(Duel* duel, const Arc* arcs, unsigned nb_arcs, Arena* arena){
     int nb_cand = duelNbCandidat(duel) ;
-    int nb_arcs = graphNbArc(graph);
     int lost_arcs[nb_cand];
-
-    deleteGraph(&graph);
+    RankedPairs* ranked_pairs = createRankedPairs(nb_cand, arena);
 
     for(int i = 0; i<nb_cand; i++) lost_arcs[i] = 0;
-    Arc* arc_current;
-    int src_id;
-    for(int i = 0; i<nb_arcs; i++){
-        arc_current =(Arc*) genListGet(arcs_sorted, i);
-        src_id = arc_current->id_dest;
-        lost_arcs[src_id]++;
+
+    /* verrouillage des paires par ordre décroissant, sauf celles qui créent un cycle */
+    const Arc* arc_current;
+    for(unsigned i = 0; i<nb_arcs; i++){
+        arc_current = &arcs[i];
+        if(!rankedPairsIsMakingCycle(ranked_pairs, arc_current->id_src, arc_current->id_dest)){
+            rankedPairsLock(ranked_pairs, arc_current->id_src, arc_current->id_dest);
+            lost_arcs[arc_current->id_dest]++;
+        }
     }
-    while(!genListEmpty(arcs_sorted))
-        free(genListPop(arcs_sorted));
-    deleteGenList(&arcs_sorted);
+    deleteRankedPairs(&ranked_pairs, arena);
     
     
     GenList* winners = createGenList(nb_cand);
 
     for(int i = 0; i < nb_cand; i++){
         if(lost_arcs[i]==0){  
-            WinnerCondorcet* cand_possible = malloc(sizeof(WinnerCondorcet));
-            char* winner_name =  duelIndexToLabel(duel, i);
-            strncpy(cand_possible->name, winner_name, MAX_LENGHT_LABEL);
+            WinnerCondorcet* cand_possible = memAlloc(arena, sizeof(WinnerCondorcet));
+            strncpy(cand_possible->name, duelIndexToLabel(duel, i), MAX_LENGHT_LABEL);
             cand_possible->score = 0;
-            free(winner_name);
             genListAdd(winners, cand_possible);
         }
     }
@@ -183,14 +160,18 @@ GenList* findWinnerGraph(Duel* duel){
  *
  * @return Le gagnant en utilisant la structure WinnerCondorcet.
 */
-GenList* theWinnerRankedPairs(Duel* duel){
+GenList* theWinnerRankedPairsArena(Duel* duel, Arena* arena){
     GenList* winners;
 
-    WinnerCondorcet* winner = CondorcetWinnerCriterion(duel);
+    WinnerCondorcet* winner = CondorcetWinnerCriterionArena(duel, arena);
 
     if (winner==NULL) {
-        free(winner);
-        winners = findWinnerGraph(duel);
+        unsigned nb_arcs;
+        int* duels = duelsFlatten(duel, arena);
+        Arc* arcs = sortedArcsCreate(duels, duelNbCandidat(duel), &nb_arcs, arena);
+        memFree(arena, duels);
+        winners = findWinnerGraph(duel, arcs, nb_arcs, arena);
+        memFree(arena, arcs);
     }
     else {
         winners = createGenList(1);
@@ -199,3 +180,24 @@ GenList* theWinnerRankedPairs(Duel* duel){
     return winners;
 
 }
+
+
+/**
+ * @date 16/10/2026
+ * @brief theWinnerRankedPairsArena sans arène : le résultat est alloué avec malloc
+ */
+GenList* theWinnerRankedPairs(Duel* duel){
+    return theWinnerRankedPairsArena(duel, NULL);
+}
+
+
+
+/**
+ * @date 16/10/2026
+ */
+GenList* theWinnerRankedPairsShared(CondorcetShared* shared, Arena* arena){
+    GenList* winners = sharedCondorcetWinner(shared, arena);
+    if (winners==NULL)
+        winners = findWinnerGraph(shared->duel, shared->arcs, shared->nb_arcs, arena);
+    return winners;
+}
\ No newline at end of file
@@ -24,191 +24,199 @@
 #include <string.h>
 #include <malloc.h>
 #include "../structure/genericlist.h"
-#include "../structure/graph.h"
 #include "condorcet.h"
+#include "../utils/parallel.h"
 #include "../structure/data_struct_utils.h"
 
 
-/**
- * @date 16/12/2023
- * @author Alina IVANOVA
- * @brief retourne la valeur maximale
- */
-int max(int a, int b) {
-    return (a > b) ? a : b;
-}
+/* taille (en candidats) des blocs du calcul des chemins : 3 blocs de 64x64 int tiennent en cache L1/L2 */
+#define SCHULZE_BLOCK 64
+/* nombre minimum de lignes de la matrice des chemins traitées par chaque thread */
+#define SCHULZE_MIN_ROWS_PER_THREAD 16
+
 
 /**
- * @date 16/12/2023
- * @author Alina IVANOVA
- * @brief retourne la valeur minimale
+ * @date 16/10/2026
+ * @brief Matrice plate (nb_cand x nb_cand) des arcs du graphe de Schulze : le gagnant d'un
+ * duel a la valeur du duel comme poids et son adversaire 0 (égalité : le second candidat gagne)
+ *
+ * @param[in] duels matrice plate des duels (voir @ref duelsFlatten)
+ * @param[in] nb_cand nombre de candidats
+ *
+ * @return tableau paths, paths[i*nb_cand+j] = poids de l'arc i -> j (à libérer)
  */
-int min(int a, int b) {
-    return (a < b) ? a : b;
+int* schulzeMargins(const int* duels, unsigned nb_cand, Arena* arena){
+    int* paths = memAlloc(arena, sizeof(int)*(nb_cand > 0 ? (size_t)nb_cand*nb_cand : 1));
+    int cand1_vs, cand2_vs;
+
+    for(unsigned i = 0; i < nb_cand; i++){
+        paths[(size_t)i*nb_cand + i] = 0;
+        for(unsigned j = i+1; j < nb_cand; j++){
+            cand1_vs = duels[(size_t)i*nb_cand + j];
+            cand2_vs = duels[(size_t)j*nb_cand + i];
+            if(cand1_vs > cand2_vs) {
+                paths[(size_t)i*nb_cand + j] = cand1_vs;
+                paths[(size_t)j*nb_cand + i] = 0;
+            } else {
+                paths[(size_t)j*nb_cand + i] = cand2_vs;
+                paths[(size_t)i*nb_cand + j] = 0;
+            }
+        }
+    }
+    return paths;
 }
 
 
-
 /**
- * @date 16/12/2023
- * @author Alina IVANOVA
- * @brief creation des arcs à partir des duel, le gagnant a le valeur de duel comme un weight et son adversaire a 0
+ * @date 16/10/2026
+ * @brief Relâche les lignes [i_begin, i_end[ du bloc de colonnes jb par les candidats
+ * intermédiaires du bloc kb : paths[i][j] = max(paths[i][j], min(paths[i][k], paths[k][j]))
+ *
+ * @param[in,out] paths matrice plate des chemins
+ * @param[in] nb_cand nombre de candidats
+ * @param[in] i_begin première ligne (candidat source)
+ * @param[in] i_end fin (exclue) des lignes
+ * @param[in] jb premier candidat destination du bloc
+ * @param[in] kb premier candidat intermédiaire du bloc
  */
-GenList* arcsCreate(Duel* duel){
-    //creating a graph
-    int nb_cand = duelNbCandidat(duel) ;
-    GenList* arcs = createGenList(nb_cand*(nb_cand-1));
-
-    for ( int i = 0; i< nb_cand ; i++){
-        for ( int j = i+1; j<nb_cand; j++){  
-            //adding the arc or duel to the graph
-            Arc* arc = malloc(sizeof(Arc));
-            Arc* arc_inverse = malloc(sizeof(Arc));
-            int cand1_vs = duelGetValue(duel, i, j);
-            int cand2_vs = duelGetValue(duel, j, i);
-
-            if(cand1_vs>cand2_vs) {
-                arc->id_dest = j;
-                arc->id_src = i;
-                arc->weight = cand1_vs;
-
-                arc_inverse->id_dest = i;
-                arc_inverse->id_src = j;
-                arc_inverse->weight = 0;
+void schulzeBlock(int* paths, unsigned nb_cand, unsigned i_begin, unsigned i_end, unsigned jb, unsigned kb){
+    unsigned j_end = jb + SCHULZE_BLOCK < nb_cand ? jb + SCHULZE_BLOCK : nb_cand;
+    unsigned k_end = kb + SCHULZE_BLOCK < nb_cand ? kb + SCHULZE_BLOCK : nb_cand;
+    int *row_i, *row_k;
+    int path_ik, via_k;
+
+    for(unsigned k = kb; k < k_end; k++){
+        row_k = paths + (size_t)k*nb_cand;
+        for(unsigned i = i_begin; i < i_end; i++){
+            row_i = paths + (size_t)i*nb_cand;
+            path_ik = row_i[k];
+            /* boucle sans branchement (vectorisable) */
+            for(unsigned j = jb; j < j_end; j++){
+                via_k = path_ik < row_k[j] ? path_ik : row_k[j];
+                row_i[j] = row_i[j] > via_k ? row_i[j] : via_k;
             }
-            else {
-                arc->id_dest = i;
-                arc->id_src = j;
-                arc->weight = cand2_vs;
-
-                arc_inverse->id_dest = j;
-                arc_inverse->id_src = i;
-                arc_inverse->weight = 0;
-            } 
-            genListAdd(arcs, arc);
-            genListAdd(arcs, arc_inverse);
-        }    
+        }
     }
-
-    return arcs;
 }
 
 
-
 /**
- * @date 16/12/2023
- * @author Alina IVANOVA
- * @brief creation d'un graphe à partir de duel
+ * @date 16/10/2026
+ * @brief Contexte du calcul parallèle des chemins pour un bloc de candidats intermédiaires
  */
+typedef struct s_schulze_parallel {
+    int* paths;         /* matrice plate des chemins */
+    unsigned nb_cand;   /* nombre de candidats */
+    unsigned kb;        /* premier candidat du bloc intermédiaire courant */
+} SchulzeParallel;
 
-Graph* graphCreate(Duel* duel){
-    int nb_cand = duelNbCandidat(duel) ;
-    GenList* labels_graph = createGenList(sizeof(char)*nb_cand);
-    for(int i = 0; i < nb_cand; i++){
-        genListAdd(labels_graph, duelIndexToLabel(duel, i));
-    }
 
-    Graph* winner_graph = createGraph(nb_cand, labels_graph);
-
-    GenList* arcs_list = arcsCreate(duel);
-
-    for (int i = 0; i< nb_cand*(nb_cand-1); i++){
-        Arc* arc_current = genListGet(arcs_list, i);
-        graphAdd(winner_graph,arc_current->id_src ,arc_current->id_dest , arc_current->weight);
+/**
+ * @date 16/10/2026
+ * @brief Relâche la ligne et la colonne de blocs kb, réparties par blocs entre les threads
+ * (fonction de thread)
+ */
+void schulzeCrossThread(unsigned id, unsigned nb_threads, void* arg){
+    SchulzeParallel* sp = (SchulzeParallel*)arg;
+    unsigned nb_blocks = (sp->nb_cand + SCHULZE_BLOCK - 1) / SCHULZE_BLOCK;
+    unsigned kb = sp->kb, k_end = kb + SCHULZE_BLOCK < sp->nb_cand ? kb + SCHULZE_BLOCK : sp->nb_cand;
+    unsigned begin, end, b, b_end;
+
+    parallelSplit(nb_blocks, id, nb_threads, &begin, &end);
+    for(unsigned block = begin; block < end; block++){
+        b = block * SCHULZE_BLOCK;
+        if(b == kb) continue;
+        b_end = b + SCHULZE_BLOCK < sp->nb_cand ? b + SCHULZE_BLOCK : sp->nb_cand;
+        schulzeBlock(sp->paths, sp->nb_cand, kb, k_end, b, kb);
+        schulzeBlock(sp->paths, sp->nb_cand, b, b_end, kb, kb);
     }
-
-    while(!genListEmpty(labels_graph))
-        free(genListPop(labels_graph));
-    deleteGenList(&labels_graph);
-
-    while(!genListEmpty(arcs_list))
-        free(genListPop(arcs_list));
-    deleteGenList(&arcs_list);
-
-    return winner_graph;
 }
 
 
-
-
 /**
- * @date 16/12/2023
- * @author Alina IVANOVA
- * @brief modification de graph pour que le weight = le chemin entre source et destination
+ * @date 16/10/2026
+ * @brief Relâche les blocs hors de la ligne et de la colonne kb, les lignes sont réparties
+ * entre les threads (fonction de thread)
  */
-
-Graph* findingPaths(Duel* duel){
-    Graph* graph_for_search = graphCreate(duel);
-    int nb_cand = duelNbCandidat(duel);
-    int cand_2vs1, cand_3vs1, cand_2vs3;
-
-    for(int cand_3 = 0; cand_3<nb_cand; cand_3++){
-        for(int cand_2 = 0;cand_2<nb_cand; cand_2++){
-            
-            if (cand_2!=cand_3){
-                for(int cand_1 = 0; cand_1 < nb_cand; cand_1++){
-                    
-                    if(cand_3!=cand_1 && cand_1!=cand_2){
-
-                        cand_2vs1 = graphGetWeight(graph_for_search, cand_2, cand_1);
-                        cand_2vs3 = graphGetWeight(graph_for_search, cand_2, cand_3);
-                        cand_3vs1 = graphGetWeight(graph_for_search, cand_3, cand_1);
-                        
-                        int weight = max(cand_2vs1, min(cand_2vs3, cand_3vs1));
-
-                        graphSetWeight(graph_for_search, cand_2, cand_1, weight);
-                    }
-                }
-            } 
+void schulzeRestThread(unsigned id, unsigned nb_threads, void* arg){
+    SchulzeParallel* sp = (SchulzeParallel*)arg;
+    unsigned kb = sp->kb, k_end = kb + SCHULZE_BLOCK < sp->nb_cand ? kb + SCHULZE_BLOCK : sp->nb_cand;
+    unsigned begin, end, i_end;
+
+    parallelSplit(sp->nb_cand, id, nb_threads, &begin, &end);
+    /* lignes du thread par paquets de SCHULZE_BLOCK, sans les lignes du bloc kb */
+    for(unsigned i = begin; i < end; i = i_end){
+        if(i >= kb && i < k_end) {
+            i_end = k_end < end ? k_end : end;
+            continue;
         }
+        i_end = i + SCHULZE_BLOCK < end ? i + SCHULZE_BLOCK : end;
+        if(i < kb && i_end > kb) i_end = kb;
+        for(unsigned jb = 0; jb < sp->nb_cand; jb += SCHULZE_BLOCK)
+            if(jb != kb)
+                schulzeBlock(sp->paths, sp->nb_cand, i, i_end, jb, kb);
     }
-    return graph_for_search;
 }
 
 
-
 /**
- * @date 16/12/2023
- * @author Alina IVANOVA
- * @brief creation d'un duel à partir d'une graphe des chemins
+ * @date 16/10/2026
+ * @brief Remplace le poids des arcs par la force du chemin le plus fort entre chaque paire de
+ * candidats (Floyd-Warshall par blocs, sur nb_threads threads)
+ *
+ * Pour chaque bloc de candidats intermédiaires kb : le bloc diagonal, puis la ligne et la colonne
+ * de blocs kb, puis les autres blocs qui ne dépendent que des précédents. Chaque étape écrit des
+ * blocs disjoints et ne lit que des blocs terminés : elle est répartie entre les threads.
+ *
+ * @param[in,out] paths matrice plate des arcs (voir @ref schulzeMargins)
+ * @param[in] nb_cand nombre de candidats
+ * @param[in] nb_threads nombre de threads
+ * @pre 1 <= nb_threads <= @ref PARALLEL_MAX_THREADS
+ *
+ * @note la diagonale est modifiée mais n'intervient pas dans les autres chemins
  */
-
-Duel* createDuelfromGraph(Graph* graph){
-    int nb_cand = graphNbVertex(graph);
-    GenList* labels = createGenList(nb_cand);
-    for (int i = 0 ; i<nb_cand; i++){
-        genListAdd(labels, graphGetLabel(graph, i));
+void schulzeWidestPathsParallel(int* paths, unsigned nb_cand, unsigned nb_threads){
+    SchulzeParallel sp = {paths, nb_cand, 0};
+
+    for(unsigned kb = 0; kb < nb_cand; kb += SCHULZE_BLOCK){
+        sp.kb = kb;
+        schulzeBlock(paths, nb_cand, kb, kb + SCHULZE_BLOCK < nb_cand ? kb + SCHULZE_BLOCK : nb_cand, kb, kb);
+        parallelRun(schulzeCrossThread, nb_threads, &sp);
+        parallelRun(schulzeRestThread, nb_threads, &sp);
     }
+}
 
-    Duel* duel = createDuel(nb_cand, labels);
-    for(int cand = 0; cand< nb_cand; cand++){
-        for(int cand_2 = cand+1 ; cand_2 < nb_cand; cand_2++){
-            duelSetValue(duel, cand, cand_2, graphGetWeight(graph, cand, cand_2));
-            duelSetValue(duel, cand_2, cand , graphGetWeight(graph, cand_2, cand));
-        }
-    }
 
-    while(!genListEmpty(labels))
-        free(genListPop(labels));
-    deleteGenList(&labels);
+/**
+ * @date 16/10/2026
+ * @brief Remplace le poids des arcs par la force du chemin le plus fort entre chaque paire de
+ * candidats, sur au plus @ref parallelNbThreads threads
+ *
+ * @param[in,out] paths matrice plate des arcs (voir @ref schulzeMargins)
+ * @param[in] nb_cand nombre de candidats
+ */
+void schulzeWidestPaths(int* paths, unsigned nb_cand){
+    unsigned nb_threads = parallelNbThreads();
+    unsigned max_threads = nb_cand / SCHULZE_MIN_ROWS_PER_THREAD;
+    if(max_threads < nb_threads)
+        nb_threads = max_threads < 1 ? 1 : max_threads;
 
-    return duel;
+    schulzeWidestPathsParallel(paths, nb_cand, nb_threads);
 }
 
 
 /**
  * @date 16/12/2023
  * @author Alina IVANOVA
- * @brief creation d'un genlist de(s) gagnat(s) à partir d'un duel des chemins
+ * @brief creation d'un genlist de(s) gagnat(s) à partir des chemins les plus forts
+ *
+ * @param[in] duel matrice des duels (labels des candidats)
+ * @param[in] duels matrice plate des duels (voir @ref duelsFlatten)
  */
-GenList* findWinnerGraphPath(Duel* duel){
-    Graph* graph_path = findingPaths(duel);
-    Duel* duel_path = createDuelfromGraph(graph_path);
-
-
-    deleteGraph(&graph_path);
-
+GenList* findWinnerGraphPath(Duel* duel, const int* duels, Arena* arena){
     int nb_cand= duelNbCandidat(duel);
+    int* paths = schulzeMargins(duels, nb_cand, arena);
+    schulzeWidestPaths(paths, nb_cand);
 
     GenList* candidates = createGenList(1);
     int max_wins = 0;
@@ -216,37 +224,31 @@ GenList* findWinnerGraphPath(Duel* duel){
         int winsCandidate = 0;
         
         for (int cand_2 = 0; cand_2 < nb_cand; cand_2++){
-            int win = duelGetValue(duel_path, cand_1, cand_2); 
-            int loss = duelGetValue(duel_path, cand_2, cand_1); 
+            int win = paths[cand_1*nb_cand + cand_2];
+            int loss = paths[cand_2*nb_cand + cand_1];
             if(win >= loss)winsCandidate++;
         }
 
         if (max_wins<winsCandidate){
-           while(genListSize(candidates)!=0) free((WinnerCondorcet*)genListPop(candidates));
+           while(genListSize(candidates)!=0) memFree(arena, genListPop(candidates));
             max_wins = winsCandidate;
             
-            WinnerCondorcet* cand_possible = malloc(sizeof(WinnerCondorcet));
+            WinnerCondorcet* cand_possible = memAlloc(arena, sizeof(WinnerCondorcet));
             
             cand_possible->score = winsCandidate;
-            char* winner_name =  duelIndexToLabel(duel_path, cand_1);
-            strncpy(cand_possible->name, winner_name, MAX_LENGHT_LABEL);
-            
-            free(winner_name);
+            strncpy(cand_possible->name, duelIndexToLabel(duel, cand_1), MAX_LENGHT_LABEL);
             genListAdd(candidates, cand_possible);
         }
         else if (max_wins == winsCandidate) {
-            WinnerCondorcet* cand_possible = malloc(sizeof(WinnerCondorcet));
+            WinnerCondorcet* cand_possible = memAlloc(arena, sizeof(WinnerCondorcet));
             
             cand_possible->score = winsCandidate;
-            char* winner_name =  duelIndexToLabel(duel_path, cand_1);
-            strncpy(cand_possible->name, winner_name, MAX_LENGHT_LABEL);
-            
-            free(winner_name);
+            strncpy(cand_possible->name, duelIndexToLabel(duel, cand_1), MAX_LENGHT_LABEL);
             genListAdd(candidates, cand_possible);
         }
     }
 
-    deleteDuel(&duel_path);
+    memFree(arena, paths);
 
     return candidates;
 
@@ -262,15 +264,37 @@ GenList* findWinnerGraphPath(Duel* duel){
  *
  * @return Le gagnant en utilisant la structure WinnerCondorcet.
 */
-GenList* theWinnerSchulze(Duel* duel){
+GenList* theWinnerSchulzeArena(Duel* duel, Arena* arena){
     GenList* winners;
-    WinnerCondorcet* winner_condorcet = CondorcetWinnerCriterion(duel);
+    WinnerCondorcet* winner_condorcet = CondorcetWinnerCriterionArena(duel, arena);
     if (winner_condorcet==NULL) {
-        winners = findWinnerGraphPath(duel);
+        int* duels = duelsFlatten(duel, arena);
+        winners = findWinnerGraphPath(duel, duels, arena);
+        memFree(arena, duels);
     }
     else {
         winners = createGenList(1);
         genListAdd(winners,winner_condorcet);
     }
     return winners;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief theWinnerSchulzeArena sans arène : le résultat est alloué avec malloc
+ */
+GenList* theWinnerSchulze(Duel* duel){
+    return theWinnerSchulzeArena(duel, NULL);
+}
+
+
+/**
+ * @date 16/10/2026
+ */
+GenList* theWinnerSchulzeShared(CondorcetShared* shared, Arena* arena){
+    GenList* winners = sharedCondorcetWinner(shared, arena);
+    if (winners==NULL)
+        winners = findWinnerGraphPath(shared->duel, shared->duels, arena);
+    return winners;
 }
\ No newline at end of file
@@ -22,130 +22,427 @@
 #include "majority_judgment.h"
 #include "../logger.h"
 
+/* nombre maximum de notes de la partie dense des histogrammes (écart entre la plus petite et
+   la plus grande note), les notes hors de cet intervalle sont comptées à part */
+#define MJ_MAX_GRADES (1u << 16)
+
+/* capacité initiale de la liste des notes hors de l'intervalle dense */
+#define MJ_OUTLIERS_CAPACITY 64
+
+/**
+ * @date 16/10/2026
+ * @brief Contexte d'évaluation d'une élection : aucune variable globale, plusieurs
+ * élections peuvent être évaluées en même temps sur des threads différents
+ *
+ * Histogrammes cumulés des notes (voir @ref createMJContext pour la lecture des cases) : les
+ * notes d'indices nb_below à nb_below + nb_dense - 1 sont low, low + 1, ... (partie dense), les
+ * autres sont les notes trop éloignées triées dans grades (nb_below plus petites que low, puis
+ * les plus grandes). Le candidat c a nb_grades + 1 compteurs à partir de
+ * cumul + c * (nb_grades + 1) : le compteur k est le nombre de votants (poids) lui ayant
+ * donné une note d'indice < k.
+ */
+typedef struct mj_context_s {
+    Bale* bale;         /* ballot source */
+    int min_value;      /* bornes des notes atteignables par décalage de la médiane */
+    int max_value;
+    unsigned nb_votes;  /* nombre de votants (somme des poids) */
+    unsigned nb_cand;
+    int low;            /* plus petite note de la partie dense */
+    unsigned nb_dense;  /* nombre de notes de la partie dense */
+    unsigned nb_below;  /* nombre de notes éloignées plus petites que low */
+    unsigned nb_grades; /* nombre total de notes des histogrammes */
+    int* grades;        /* notes éloignées triées, NULL si aucune */
+    unsigned* cumul;    /* histogrammes cumulés */
+    struct candidate_s** alive; /* tampon des candidats restants (filterWinners) */
+    Arena* arena;       /* arène des allocations (NULL : malloc) */
+} MJContext;
+
 typedef struct candidate_s {
     int index;
-    int* votes;
+    Arena* arena;       /* arène des allocations du candidat (NULL : malloc) */
+    MJContext* ctx;     /* contexte de l'élection (partagé) */
+    const unsigned* cumul; /* histogramme cumulé du candidat dans ctx */
     float original_percent_inf;
-    float current_percent_inf;
+    unsigned current_inf;   /* nombre d'opposants à la médiane décalée de inf_shift */
     int inf_shift;
     float original_percent_sup;
-    float current_percent_sup;
+    unsigned current_sup;   /* nombre de partisans à la médiane décalée de sup_shift */
     int sup_shift;
 } Candidate;
 
-Candidate* createCandidate(int index) {
-    Candidate* candidate = malloc(sizeof(Candidate));
+Candidate* createCandidate(int index, MJContext* ctx) {
+    Candidate* candidate = memAlloc(ctx->arena, sizeof(Candidate));
     candidate->index = index;
-    candidate->votes = NULL;
+    candidate->arena = ctx->arena;
+    candidate->ctx = ctx;
+    candidate->cumul = ctx->cumul + (size_t)index * (ctx->nb_grades + 1);
     candidate->original_percent_inf = 0.0f;
-    candidate->current_percent_inf = 0.0f;
+    candidate->current_inf = 0;
     candidate->inf_shift = 0;
     candidate->original_percent_sup = 0.0f;
-    candidate->current_percent_sup = 0.0f;
+    candidate->current_sup = 0;
     candidate->sup_shift = 0;
     return candidate;
 }
 
 void deleteCandidate(Candidate** cand) {
     if (cand == NULL || *cand == NULL) return;
-    if ((*cand)->votes != NULL) {
-        free((*cand)->votes);
-    }
-    free(*cand);
+    memFree((*cand)->arena, *cand);
     cand = NULL;
 }
 
+
 /**
- * @date 15/12/2023
- * @author Alina IVANOVA
+ * @date 16/10/2026
+ * @brief Agrandit l'intervalle des notes pour contenir la note v (note hors des bornes
+ * attendues, cas rare)
+ *
+ * Pendant le remplissage, le compteur k + 1 d'un candidat contient le nombre de votants
+ * ayant donné la note low + k.
+ *
+ * @return false si l'intervalle dépasserait @ref MJ_MAX_GRADES notes (histogramme inchangé,
+ * la note est alors comptée à part)
  */
-int compare(const void *a, const void *b) {
-    return (*(int *)a - *(int *)b);
+bool growGrades(MJContext* ctx, int v) {
+    long long low = v < ctx->low ? v : ctx->low;
+    long long high = (long long)ctx->low + ctx->nb_dense - 1;
+    if (v > high) high = v;
+    if (high - low + 1 > MJ_MAX_GRADES)
+        return false;
+
+    unsigned nb_grades = (unsigned)(high - low + 1);
+    unsigned offset = (unsigned)(ctx->low - low);
+    unsigned* cumul = memCalloc(ctx->arena, (size_t)ctx->nb_cand * (nb_grades + 1), sizeof(unsigned));
+    for (unsigned c = 0; c < ctx->nb_cand; c++)
+        memcpy(cumul + (size_t)c * (nb_grades + 1) + 1 + offset,
+            ctx->cumul + (size_t)c * (ctx->nb_dense + 1) + 1, ctx->nb_dense * sizeof(unsigned));
+    memFree(ctx->arena, ctx->cumul);
+    ctx->cumul = cumul;
+    ctx->low = (int)low;
+    ctx->nb_dense = nb_grades;
+    ctx->nb_grades = nb_grades;
+    return true;
 }
 
 
 /**
- * @date 15/12/2023
- * @author Alina IVANOVA
- * @brief creation d'une liste des votes dans un ordre décroissant 
+ * @date 16/10/2026
+ * @brief Lit une case du ballot comme note (voir @ref createMJContext)
+ */
+static inline int cellToGrade(const MJContext* ctx, int cell, bool is_bale_judgment) {
+    if (!is_bale_judgment)
+        return cell < 1 ? ctx->max_value : cell;
+    return cell == -1 ? (int)ctx->nb_cand : cell;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Nombre de notes du tableau trié tab (n notes) strictement plus petites que grade
+ */
+unsigned gradesBelow(const int* tab, unsigned n, long long grade) {
+    unsigned begin = 0, end = n, middle;
+    while (begin < end) {
+        middle = begin + (end - begin) / 2;
+        if (tab[middle] < grade) begin = middle + 1;
+        else end = middle;
+    }
+    return begin;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Indice de la première note >= grade dans les histogrammes (nb_grades si aucune)
+ */
+unsigned gradeIndex(const MJContext* ctx, long long grade) {
+    unsigned nb_above = ctx->nb_grades - ctx->nb_below - ctx->nb_dense;
+    long long k = grade - ctx->low;
+    if (k <= 0)
+        return gradesBelow(ctx->grades, ctx->nb_below, grade);
+    if (k < ctx->nb_dense)
+        return ctx->nb_below + (unsigned)k;
+    return ctx->nb_below + ctx->nb_dense + gradesBelow(ctx->grades + ctx->nb_below, nb_above, grade);
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Note d'indice k des histogrammes
  */
-void sortingVotesCandidate(Bale* bale, Candidate* candidate) {
-    int nb_votes = baleNbVoter(bale);
-    int* votes = malloc(sizeof(int)*nb_votes);
-    for (int voter = 0; voter<nb_votes; voter++){
-        votes[voter] = baleGetValue(bale, voter, candidate->index);
-        if(votes[voter] ==-1) votes[voter] = baleNbCandidat(bale);
+int gradeAt(const MJContext* ctx, unsigned k) {
+    if (k < ctx->nb_below)
+        return ctx->grades[k];
+    if (k < ctx->nb_below + ctx->nb_dense)
+        return ctx->low + (int)(k - ctx->nb_below);
+    return ctx->grades[k - ctx->nb_dense];
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Votes dont la note est hors de l'intervalle dense (cas rare), regroupés par note et
+ * par candidat
+ */
+typedef struct mj_outlier_s {
+    int grade;
+    unsigned cand;
+    unsigned weight;    /* somme des poids */
+} Outlier;
+
+typedef struct mj_outliers_s {
+    Outlier* tab;
+    size_t size;
+    size_t capacity;
+} Outliers;
+
+
+int compareOutliers(const void* a, const void* b) {
+    const Outlier *x = a, *y = b;
+    if (x->grade != y->grade) return (x->grade > y->grade) - (x->grade < y->grade);
+    return (x->cand > y->cand) - (x->cand < y->cand);
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Trie les votes éloignés et fusionne ceux de même note et de même candidat
+ */
+void compactOutliers(Outliers* out) {
+    size_t n = 0;
+    if (out->size == 0) return;
+    qsort(out->tab, out->size, sizeof(Outlier), compareOutliers);
+    for (size_t i = 1; i < out->size; i++) {
+        if (out->tab[i].grade == out->tab[n].grade && out->tab[i].cand == out->tab[n].cand)
+            out->tab[n].weight += out->tab[i].weight;
+        else
+            out->tab[++n] = out->tab[i];
+    }
+    out->size = n + 1;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Ajoute un vote éloigné, la liste est compactée quand elle est pleine et agrandie
+ * seulement si la compaction libère moins de la moitié de la place
+ */
+void addOutlier(MJContext* ctx, Outliers* out, int grade, unsigned cand, unsigned weight) {
+    if (out->size == out->capacity) {
+        compactOutliers(out);
+        if (out->size > out->capacity / 2) {
+            Outlier* tab = memAlloc(ctx->arena, 2 * out->capacity * sizeof(Outlier));
+            memcpy(tab, out->tab, out->size * sizeof(Outlier));
+            memFree(ctx->arena, out->tab);
+            out->tab = tab;
+            out->capacity *= 2;
+        }
     }
-    qsort(votes, nb_votes, sizeof(int), compare);
-    candidate->votes = votes;
+    out->tab[out->size].grade = grade;
+    out->tab[out->size].cand = cand;
+    out->tab[out->size].weight = weight;
+    out->size++;
 }
 
 
+/**
+ * @date 16/10/2026
+ * @brief Ajoute aux histogrammes les notes éloignées : chaque note distincte reçoit un
+ * compteur, à gauche ou à droite de la partie dense
+ */
+void mergeOutliers(MJContext* ctx, Outliers* out) {
+    unsigned nb_cand = ctx->nb_cand, nb_out = 0, stride;
+    compactOutliers(out);
+
+    /* notes distinctes, déjà triées */
+    int* grades = memAlloc(ctx->arena, out->size * sizeof(int));
+    for (size_t i = 0; i < out->size; i++)
+        if (nb_out == 0 || out->tab[i].grade != grades[nb_out - 1])
+            grades[nb_out++] = out->tab[i].grade;
+
+    ctx->grades = grades;
+    ctx->nb_below = gradesBelow(grades, nb_out, ctx->low);
+    ctx->nb_grades = ctx->nb_dense + nb_out;
+    stride = ctx->nb_grades + 1;
+
+    /* partie dense recopiée après les notes plus petites */
+    unsigned* cumul = memCalloc(ctx->arena, (size_t)nb_cand * stride, sizeof(unsigned));
+    for (unsigned c = 0; c < nb_cand; c++)
+        memcpy(cumul + (size_t)c * stride + 1 + ctx->nb_below,
+            ctx->cumul + (size_t)c * (ctx->nb_dense + 1) + 1, ctx->nb_dense * sizeof(unsigned));
+    memFree(ctx->arena, ctx->cumul);
+    ctx->cumul = cumul;
+
+    for (size_t i = 0; i < out->size; i++)
+        cumul[(size_t)out->tab[i].cand * stride + 1 + gradeIndex(ctx, out->tab[i].grade)] += out->tab[i].weight;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Effectifs de chaque note en un seul passage sur le ballot
+ *
+ * L'intervalle dense est agrandi si une note sort des bornes attendues, tant qu'il ne dépasse
+ * pas @ref MJ_MAX_GRADES notes : les notes plus éloignées sont comptées dans une petite liste
+ * triée, fusionnée dans les histogrammes à la fin.
+ */
+void fillGrades(MJContext* ctx, bool is_bale_judgment) {
+    unsigned nb_cand = ctx->nb_cand, nb_lines = baleNbLine(ctx->bale);
+    int line[nb_cand > 0 ? nb_cand : 1];
+    Outliers out;
+    unsigned weight;
+    long long k;
+    int v;
+
+    out.tab = memAlloc(ctx->arena, MJ_OUTLIERS_CAPACITY * sizeof(Outlier));
+    out.size = 0;
+    out.capacity = MJ_OUTLIERS_CAPACITY;
+
+    for (unsigned l = 0; l < nb_lines; l++) {
+        baleGetLine(ctx->bale, l, line);
+        weight = baleLineWeight(ctx->bale, l);
+        for (unsigned c = 0; c < nb_cand; c++) {
+            v = cellToGrade(ctx, line[c], is_bale_judgment);
+            k = (long long)v - ctx->low;
+            if (k < 0 || k >= ctx->nb_dense) {
+                if (!growGrades(ctx, v)) {
+                    addOutlier(ctx, &out, v, c, weight);
+                    continue;
+                }
+                k = (long long)v - ctx->low;
+            }
+            ctx->cumul[(size_t)c * (ctx->nb_dense + 1) + 1 + k] += weight;
+        }
+    }
+
+    if (out.size > 0)
+        mergeOutliers(ctx, &out);
+    memFree(ctx->arena, out.tab);
+}
+
+/**
+ * @date 16/10/2026
+ * @brief Crée le contexte d'évaluation d'une élection et calcule en un seul passage sur
+ * le ballot les histogrammes cumulés des notes de chaque candidat
+ *
+ * Les cases sont lues comme notes sans copie du ballot :
+ * - ballot de classements : notes de 1 au nombre de candidats, rang < 1 (non classé) lu
+ * comme la dernière note
+ * - ballot de mentions : notes de 1 à 6, -1 lu comme le nombre de candidats
+ *
+ * @param[in] bale ballot source
+ * @param[in] is_bale_judgment true si le ballot contient des mentions
+ * @param[in] arena arène des allocations (NULL : malloc)
+ * @return contexte, à libérer avec @ref deleteMJContext
+ */
+MJContext* createMJContext(Bale* bale, bool is_bale_judgment, Arena* arena) {
+    unsigned nb_cand = baleNbCandidat(bale);
+    MJContext* ctx = memAlloc(arena, sizeof(MJContext));
+    unsigned stride;
+    unsigned* counts;
+
+    ctx->bale = bale;
+    ctx->min_value = 1;
+    ctx->max_value = is_bale_judgment ? 6 : (int)nb_cand;
+    ctx->nb_votes = baleNbVoter(bale);
+    ctx->nb_cand = nb_cand;
+    ctx->alive = memAlloc(arena, (nb_cand > 0 ? nb_cand : 1) * sizeof(Candidate*));
+    ctx->arena = arena;
+
+    /* histogrammes sur les bornes attendues, -1 d'un ballot de mentions est lu comme
+       le nombre de candidats */
+    ctx->low = ctx->min_value;
+    ctx->nb_dense = (unsigned)(ctx->max_value - ctx->min_value + 1);
+    if (is_bale_judgment && ctx->max_value < (int)nb_cand)
+        ctx->nb_dense = nb_cand - (unsigned)ctx->min_value + 1;
+    ctx->nb_below = 0;
+    ctx->nb_grades = ctx->nb_dense;
+    ctx->grades = NULL;
+    ctx->cumul = memCalloc(arena, (size_t)nb_cand * (ctx->nb_dense + 1), sizeof(unsigned));
+
+    /* effectifs de chaque note */
+    fillGrades(ctx, is_bale_judgment);
+
+    /* sommes préfixes */
+    stride = ctx->nb_grades + 1;
+    for (unsigned c = 0; c < nb_cand; c++) {
+        counts = ctx->cumul + (size_t)c * stride;
+        for (unsigned i = 1; i < stride; i++)
+            counts[i] += counts[i - 1];
+    }
+    return ctx;
+}
+
+/**
+ * @date 16/10/2026
+ * @brief Libère le contexte d'évaluation
+ */
+void deleteMJContext(MJContext** ctx) {
+    memFree((*ctx)->arena, (*ctx)->alive);
+    memFree((*ctx)->arena, (*ctx)->cumul);
+    memFree((*ctx)->arena, (*ctx)->grades);
+    memFree((*ctx)->arena, *ctx);
+    *ctx = NULL;
+}
+
+/**
+ * @date 16/10/2026
+ * @brief Nombre de votants (poids) ayant donné au candidat une note < grade
+ */
+unsigned votesBelow(Candidate* candidate, long long grade) {
+    return candidate->cumul[gradeIndex(candidate->ctx, grade)];
+}
+
 
 /**
  * @date 15/12/2023
  * @author Alina IVANOVA
  * @brief on cherche la mediane d'un candidat
  */
-int medianCandidate(Bale* bale, Candidate* candidate) {
-    if (candidate->votes == NULL)
-        sortingVotesCandidate(bale, candidate);
-    int nb_votes = baleNbVoter(bale);
-    int a;
+int medianCandidate(MJContext* ctx, Candidate* candidate) {
+    unsigned nb_votes = ctx->nb_votes;
+    unsigned rank;
     if(nb_votes%2!=0) {
-        a = candidate->votes[(nb_votes/2)];
+        rank = nb_votes/2;
     } else{
-        a = candidate->votes[nb_votes/2 - 1];
+        rank = nb_votes/2 - 1;
     }
-    return a;
+    /* note du votant de rang rank : première note dont l'effectif cumulé dépasse rank */
+    unsigned nb_grades = ctx->nb_grades, k = 0;
+    while(k + 1 < nb_grades && candidate->cumul[k + 1] <= rank)
+        k++;
+    return gradeAt(ctx, k);
 }
 
 
 /**
  * @date 15/12/2023
  * @author IVANOVA Alina, LAFORGE Mateo
- * @brief calcule le pourcentage inférieur et supérieurs des votes pour un candidat
+ * @brief calcule le nombre d'opposants (notes au-dessus) et de partisans (notes en dessous)
+ * d'un candidat pour sa médiane décalée de shift, lus dans l'histogramme cumulé
  * 
- * @param[in] bale matrice ballot source
- * @param[in] candidate indice candidat
- * @param[out] precentInf pourcentage inférieur de vote du candidat
- * @param[out] percentSup pourcentage supérieur de vote du candidat
+ * @param[in] candidate candidat
+ * @param[in] median médiane des candidats
+ * @param[in] shift décalage de la médiane : opposants mis à jour si shift >= 0, partisans
+ * si shift <= 0
 */
-void computePercentagesCandidate(Bale* bale, Candidate* candidate, int median, int shift) {
-    if (candidate->votes == NULL)
-        sortingVotesCandidate(bale, candidate);
-    // calcul des pourcentages
-    int nb_votes = baleNbVoter(bale);
-    int nb_inf_vote = 0;
-    int nb_sup_vote = 0;
-    int current_vote;
-    int new_median = median + shift;
-    for (unsigned int i = 0; i < baleNbVoter(bale); i++) {
-        current_vote = candidate->votes[i];
-        if (current_vote < new_median)
-            nb_sup_vote++;
-        else if (current_vote > new_median)
-            nb_inf_vote++;
-    }
+void computeVotesCandidate(Candidate* candidate, int median, int shift) {
+    long long new_median = (long long)median + shift;
     // mise à jour sélective
     if (shift >= 0) {
-        candidate->current_percent_inf = (float) nb_inf_vote / nb_votes;
+        candidate->current_inf = candidate->cumul[candidate->ctx->nb_grades] - votesBelow(candidate, new_median + 1);
         candidate->inf_shift = shift;
     }
     if (shift <= 0) {
-        candidate->current_percent_sup = (float) nb_sup_vote / nb_votes;
+        candidate->current_sup = votesBelow(candidate, new_median);
         candidate->sup_shift = shift;
     }
 }
 
-WinnerMajorityJudgment* candidateToWinner(Bale* bale, Candidate* candidate, int median) {
-    WinnerMajorityJudgment* winner = malloc(sizeof(WinnerMajorityJudgment));
-    char* winner_name = baleColumnToLabel(bale, candidate->index);
-    strncpy(winner->name, winner_name, MAX_LENGHT_LABEL);
-    free(winner_name);
+WinnerMajorityJudgment* candidateToWinner(MJContext* ctx, Candidate* candidate, int median) {
+    WinnerMajorityJudgment* winner = memAlloc(candidate->arena, sizeof(WinnerMajorityJudgment));
+    strncpy(winner->name, baleColumnToLabel(ctx->bale, candidate->index), MAX_LENGHT_LABEL);
     winner->median = median;
-    if (candidate->current_percent_inf == 0.0f || candidate->current_percent_inf == 0.0f)
-        computePercentagesCandidate(bale, candidate, median, 0);
     winner->percent_inf = candidate->original_percent_inf;
     winner->percent_sup = candidate->original_percent_sup;
     return winner;
@@ -156,116 +453,105 @@ WinnerMajorityJudgment* candidateToWinner(Bale* bale, Candidate* candidate, int
  * @author IVANOVA Alina, LAFORGE Mateo
  * @brief peuple la liste winners des candidats dans indexCandidates avec leurs pourcentages d'opposants et partisans
  * 
- * @param[in] bale le ballot source
+ * @param[in] ctx contexte de l'élection
  * @param[in-out] winners liste des candidats vainqueurs
  * @param[in] median la mediane avec laquelle les candidats ont gagnés
  * @param[in] nbWinners nombre de vainqueurs
  * @param[in] indexCandidates listes des indices des candidats vainqueurs
  */
-void initializeCandidates(Bale* bale, GenList* candidates, int median) {
+void initializeCandidates(MJContext* ctx, GenList* candidates, int median) {
     // création de tout les candidats avec leurs pourcentages
     for (unsigned i = 0; i < genListSize(candidates); i++) {
         Candidate* candidate = genListGet(candidates, i);
-        computePercentagesCandidate(bale, candidate, median, 0);
-        candidate->original_percent_inf = candidate->current_percent_inf;
-        candidate->original_percent_sup = candidate->current_percent_sup;
+        computeVotesCandidate(candidate, median, 0);
+        candidate->original_percent_inf = (float) candidate->current_inf / ctx->nb_votes;
+        candidate->original_percent_sup = (float) candidate->current_sup / ctx->nb_votes;
     }
 }
 
 
-
-int min_value = 1;
-int max_value = 6;
-
-unsigned removeLosers(GenList* candidates, float max_percent) {
-    List* removed = createList(genListSize(candidates));
-    for (unsigned i = 0; i < genListSize(candidates); i++) {
-        Candidate* candidate = genListGet(candidates, i);
-        if (candidate->current_percent_inf == max_percent)
-            listAdd(removed, i);
-    }
-    unsigned nb_removed = listSize(removed);
-    Candidate *ctmp;
-    if (nb_removed != genListSize(candidates)) {
-        for (int i = (int) listSize(removed)-1; i >= 0; i--) {
-            ctmp = (Candidate*) genListRemove(candidates, listGet(removed, i));
-            deleteCandidate(&ctmp);
-        }
-    } else nb_removed = 0;
-    deleteList(&removed);
-    return nb_removed;
-}
-
-unsigned keepWinners(GenList* candidates, float max_percent) {
-    List* removed = createList(genListSize(candidates));
-    for (unsigned i = 0; i < genListSize(candidates); i++) {
-        Candidate* candidate = genListGet(candidates, i);
-        if (candidate->current_percent_sup != max_percent)
-            listAdd(removed, i);
-    }
-    unsigned nb_removed = listSize(removed);
-    Candidate *ctmp;
-    if (nb_removed != genListSize(candidates)) {
-        for (int i = (int) listSize(removed)-1; i >= 0; i--) {
-            ctmp = (Candidate*)genListRemove(candidates, listGet(removed, i));
-            deleteCandidate(&ctmp);
-        }
-    } else nb_removed = 0;
-    deleteList(&removed);
-    return nb_removed;
-}
-
-bool isShiftPossible(int median, int shift_value) {
+bool isShiftPossible(MJContext* ctx, int median, int shift_value) {
     int shifted_median = median + shift_value;
-    return min_value <= shifted_median && shifted_median <= max_value;
+    return ctx->min_value <= shifted_median && shifted_median <= ctx->max_value;
 }
 
-void filterWinners(Bale* bale, GenList* candidates, int median) {
-    // cas d'arrêt systématique
-    if (genListSize(candidates) == 1) return;
-    // calcul du max percent
-    float max_percent = 0.0f;
-    bool max_is_inf = false;
-    for (unsigned i = 0; i < genListSize(candidates); i++) {
-        Candidate* cand = genListGet(candidates, i);
-        if (cand->current_percent_inf > max_percent) {
-            max_percent = cand->current_percent_inf;
-            max_is_inf = true;
-        } else if (cand->current_percent_inf == max_percent) {
-            max_is_inf = true;
+/**
+ * @date 16/10/2026
+ * @brief Départage les candidats ex-aequo à la médiane
+ *
+ * À chaque étape, le plus grand groupe d'opposants ou de partisans des candidats restants
+ * est cherché (priorité aux opposants à égalité) : les candidats ayant ce nombre d'opposants
+ * sont éliminés, ou seuls ceux ayant ce nombre de partisans sont gardés. Si aucun ou tous les
+ * candidats seraient éliminés, la médiane de chacun est décalée d'une note (vers le haut pour
+ * les opposants, vers le bas pour les partisans) tant que c'est possible.
+ *
+ * Les groupes sont comparés en nombres de votants entiers lus dans les histogrammes cumulés :
+ * chaque étape est en O(candidats) et ne dépend pas des arrondis des pourcentages.
+ *
+ * @param[in] ctx contexte de l'élection
+ * @param[in-out] candidates candidats ex-aequo, seuls les gagnants y restent (dans le même ordre)
+ * @param[in] median médiane des candidats
+ */
+void filterWinners(MJContext* ctx, GenList* candidates, int median) {
+    Candidate** alive = ctx->alive;
+    unsigned nb_alive = genListSize(candidates), nb_kept, max_votes;
+    bool max_is_inf, shift_possible = true;
+    Candidate* cand;
+    int shift_value;
+
+    for (unsigned i = 0; i < nb_alive; i++)
+        alive[i] = genListGet(candidates, i);
+
+    while (nb_alive > 1 && shift_possible) {
+        // plus grand groupe d'opposants ou de partisans
+        max_votes = 0;
+        max_is_inf = false;
+        for (unsigned i = 0; i < nb_alive; i++) {
+            cand = alive[i];
+            if (cand->current_inf > max_votes) {
+                max_votes = cand->current_inf;
+                max_is_inf = true;
+            } else if (cand->current_inf == max_votes) {
+                max_is_inf = true;
+            }
+            if (cand->current_sup > max_votes) {
+                max_votes = cand->current_sup;
+                max_is_inf = false;
+            }
         }
 
-        if (cand->current_percent_sup > max_percent) {
-            max_percent = cand->current_percent_sup;
-            max_is_inf = false;
-        }
-    }
-    // traitement du max
-    if (max_is_inf) { // priorité aux groupes d'opposants
-        unsigned removed = removeLosers(candidates, max_percent);
-        if (removed == 0) {
-            for (unsigned i = 0; i < genListSize(candidates); i++) {
-                Candidate* candidate = genListGet(candidates, i);
-                int shift_value = candidate->inf_shift + 1;
-                if (!isShiftPossible(median, shift_value))
-                    return;
-                computePercentagesCandidate(bale, candidate, median, shift_value);
+        // candidats gardés
+        nb_kept = 0;
+        for (unsigned i = 0; i < nb_alive; i++)
+            nb_kept += max_is_inf ? alive[i]->current_inf != max_votes : alive[i]->current_sup == max_votes;
+
+        if (0 < nb_kept && nb_kept < nb_alive) {
+            // retrait des autres candidats, l'ordre est conservé
+            nb_kept = 0;
+            for (unsigned i = 0; i < nb_alive; i++) {
+                cand = alive[i];
+                if (max_is_inf ? cand->current_inf != max_votes : cand->current_sup == max_votes)
+                    alive[nb_kept++] = cand;
+                else
+                    deleteCandidate(&cand);
             }
-        }
-        filterWinners(bale, candidates, median);
-    } else {
-        unsigned removed = keepWinners(candidates, max_percent);
-        if (removed == 0) {
-            for (unsigned i = 0; i < genListSize(candidates); i++) {
-                Candidate* candidate = genListGet(candidates, i);
-                int shift_value = candidate->sup_shift - 1;
-                if (!isShiftPossible(median, shift_value))
-                    return;
-                computePercentagesCandidate(bale, candidate, median, shift_value);
+            nb_alive = nb_kept;
+        } else {
+            // décalage de la médiane de chaque candidat
+            for (unsigned i = 0; i < nb_alive && shift_possible; i++) {
+                shift_value = max_is_inf ? alive[i]->inf_shift + 1 : alive[i]->sup_shift - 1;
+                shift_possible = isShiftPossible(ctx, median, shift_value);
+                if (shift_possible)
+                    computeVotesCandidate(alive[i], median, shift_value);
             }
         }
-        filterWinners(bale, candidates, median);
     }
+
+    // candidats restants
+    while (!genListEmpty(candidates))
+        genListPop(candidates);
+    for (unsigned i = 0; i < nb_alive; i++)
+        genListAdd(candidates, alive[i]);
 }
 
 void clearCandidates(GenList* candidates) {
@@ -275,10 +561,10 @@ void clearCandidates(GenList* candidates) {
     }
 }
 
-void foreachCandidateToWinner(Bale* bale, GenList* dest, GenList* source, int median) {
+void foreachCandidateToWinner(MJContext* ctx, GenList* dest, GenList* source, int median) {
     for (unsigned i = 0; i < genListSize(source); i++) {
         Candidate* candidate = genListGet(source, i);
-        WinnerMajorityJudgment* winner = candidateToWinner(bale, candidate, median);
+        WinnerMajorityJudgment* winner = candidateToWinner(ctx, candidate, median);
         genListAdd(dest, winner);
         deleteCandidate(&candidate);
     }
@@ -290,47 +576,14 @@ void foreachCandidateToWinner(Bale* bale, GenList* dest, GenList* source, int me
  * @author Alina IVANOVA
  * @brief creation d'une liste de(s) gagnant(s)
  */
-GenList* theWinnerMajorityJudgment(Bale* bale, bool is_bale_judgment){
+GenList* theWinnerMajorityJudgmentArena(Bale* bale, bool is_bale_judgment, Arena* arena){
 #ifdef DEBUG
     if (baleNbCandidat(bale) < 1)
         exitl("majority_judgment.c", "theWinnerMajorityJudgement", 1, "Il n'y a pas assez de candidats pour déterminer un vainqueur\n");
 #endif
 
-    // Convertion de la donnée 
-    Bale *bale_save_tmp;
-    if(!is_bale_judgment) {
-        min_value = 1;
-        max_value = baleNbCandidat(bale);
-        unsigned nb_voter = baleNbVoter(bale);
-
-        /* récupération des labels */
-        bale_save_tmp = bale;
-        GenList *label = createGenList(nb_voter);
-        for(int i = 0; i < max_value; i++)
-            genListAdd(label, baleColumnToLabel(bale, i));
-
-        /* création du nouveau ballot */
-        bale = createBale(nb_voter, max_value, label);
-        while (!genListEmpty(label))
-            free(genListPop(label));
-        deleteGenList(&label);
-
-        /* ajout des valeurs au nouveau ballot */
-        int v;
-        for(unsigned l = 0; l < nb_voter; l++) {
-            for(int c = 0; c < max_value; c++) {
-                v = baleGetValue(bale_save_tmp, l, c);
-                if(v < 1) {
-                    baleSetValue(bale, l, c, max_value);
-                } else {
-                    baleSetValue(bale, l, c, v);
-                }
-            }
-        }
-    } else {
-        min_value = 1;
-        max_value = 6;
-    }
+    // contexte de l'élection : bornes des notes et histogrammes de tous les candidats
+    MJContext* ctx = createMJContext(bale, is_bale_judgment, arena);
 
     // calcule du vainqueur par médiane
     int nb_cand = baleNbCandidat(bale);
@@ -338,14 +591,14 @@ GenList* theWinnerMajorityJudgment(Bale* bale, bool is_bale_judgment){
     GenList* candidates = createGenList(nb_cand);
 
     // initialisation du min
-    Candidate* first_cand = createCandidate(0);
-    min_median = medianCandidate(bale, first_cand);
+    Candidate* first_cand = createCandidate(0, ctx);
+    min_median = medianCandidate(ctx, first_cand);
     genListAdd(candidates, first_cand);
 
     // pour chaques candidats
     for(int i = 1; i < nb_cand; i++){
-        Candidate* candidate = createCandidate(i);
-        current_median = medianCandidate(bale, candidate);
+        Candidate* candidate = createCandidate(i, ctx);
+        current_median = medianCandidate(ctx, candidate);
         if (current_median < min_median) {
             min_median = current_median;
             clearCandidates(candidates);
@@ -366,19 +619,25 @@ GenList* theWinnerMajorityJudgment(Bale* bale, bool is_bale_judgment){
         warnl("majority_judgment.c", "theWinnerMajorityJudgment",
             "Ex-aequo dans le vainqueur par médiane -> filtrage des gagnants\n");
         // peupler la liste winner_s des candidats ex-aequo
-        initializeCandidates(bale, candidates, min_median);
-        filterWinners(bale, candidates, min_median);
-        foreachCandidateToWinner(bale, winner_s, candidates, min_median);
+        initializeCandidates(ctx, candidates, min_median);
+        filterWinners(ctx, candidates, min_median);
+        foreachCandidateToWinner(ctx, winner_s, candidates, min_median);
     } else {
         Candidate* winner_cand = genListGet(candidates, 0);
-        WinnerMajorityJudgment* winner = candidateToWinner(bale, winner_cand, min_median);
+        WinnerMajorityJudgment* winner = candidateToWinner(ctx, winner_cand, min_median);
         genListAdd(winner_s, winner);
         deleteCandidate(&winner_cand);
     }
     deleteGenList(&candidates);
-    if(!is_bale_judgment) {
-        deleteBale(&bale);
-        bale = bale_save_tmp;
-    }
+    deleteMJContext(&ctx);
     return winner_s;
 }
+
+
+/**
+ * @date 16/10/2026
+ * @brief theWinnerMajorityJudgmentArena sans arène : le résultat est alloué avec malloc
+ */
+GenList* theWinnerMajorityJudgment(Bale* bale, bool is_bale_judgment){
+    return theWinnerMajorityJudgmentArena(bale, is_bale_judgment, NULL);
+}
@@ -27,6 +27,7 @@
 #include <errno.h>
 #include "../structure/bale.h"
 #include "../structure/data_struct_utils.h"
+#include "../utils/arena.h"
 
 
 /*------------------------------------------------------------------*/
@@ -54,6 +55,24 @@ typedef struct s_winner_MajorityJudgment {
 */
 GenList* theWinnerMajorityJudgment(Bale* bale, bool is_bale_judgment);
 
+/**
+ * @date 16/10/2026
+ * @brief Jugement majoritaire dont les gagnants et les objets temporaires (candidats,
+ * histogrammes des notes) sont alloués dans une arène
+ *
+ * @param[in] bale matrice des ballots fournis pour chaque candidat
+ * @param[in] is_bale_judgment true si le ballot contient des mentions (1 à 6), sinon les
+ * rangs sont lus comme notes (non classé : dernière note) sans copie du ballot
+ * @param[in] arena arène des allocations (NULL : malloc, comme la version sans arène)
+ *
+ * @return Liste des gagnants (WinnerMajorityJudgment) alloués dans l'arène
+ * @note Avec une arène, seule la liste (GenList) est à supprimer, les gagnants sont
+ * libérés avec l'arène
+ * @note Réentrante : plusieurs élections peuvent être évaluées en même temps sur des threads
+ * différents, chacun avec sa propre arène (ou sans arène)
+ */
+GenList* theWinnerMajorityJudgmentArena(Bale* bale, bool is_bale_judgment, Arena* arena);
+
 
 
 #endif
@@ -1,33 +1,131 @@
+#include <malloc.h>
 #include <stdlib.h>
 #include <string.h>
 #include "../structure/list.h"
+#include "../logger.h"
+#include "../utils/parallel.h"
+#include "../utils/csv_reader.h"
 #include "single_member.h"
 
+/* nombre minimum de lignes du ballot traitées par chaque thread d'un décompte */
+#define SINGLE_MIN_LINES_PER_THREAD 4096
+
+/* alignement des compteurs des threads (taille d'une ligne de cache) */
+#define COUNTERS_ALIGNMENT 64
+
+/* compteurs d'un thread alignés sur 64 octets (pas de faux partage entre threads) */
+#define COUNTERS_STRIDE(n) (((n) + 15) & ~15u)
+
+/* nombre maximum de candidats pour lesquels le résumé des duels du second tour est compté
+   pendant la lecture du premier tour (O(C²) par votant), au-delà le csv est relu */
+#define SINGLE_MAX_SUMMARY_CANDIDAT 24
+
+
+/**
+ * @date 16/10/2026
+ * @brief Contexte d'un décompte parallèle : chaque thread compte les lignes de sa part du
+ * ballot dans ses propres compteurs, réduits ensuite par l'appelant
+ */
+typedef struct s_tally_parallel {
+    Bale *bale;             /* ballot à dépouiller */
+    List *finalists;        /* candidats du second tour (NULL au premier tour) */
+    unsigned stride;        /* nombre de compteurs réservés par thread */
+    unsigned *partial;      /* compteurs des threads, stride par thread */
+} TallyParallel;
+
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie le nombre de threads à utiliser pour dépouiller le ballot
+ */
+unsigned tallyNbThreads(Bale *bale) {
+    unsigned nb_threads = parallelNbThreads();
+    unsigned max_threads = baleNbLine(bale) / SINGLE_MIN_LINES_PER_THREAD;
+    if(max_threads < nb_threads)
+        nb_threads = max_threads < 1 ? 1 : max_threads;
+    return nb_threads;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Alloue les compteurs à zéro de nb_threads threads, stride compteurs par thread
+ * (chaque bloc commence sur une ligne de cache)
+ */
+unsigned *allocCounters(unsigned nb_threads, unsigned stride) {
+    size_t size = ((size_t)nb_threads * stride + 1) * sizeof(unsigned);
+    unsigned *partial = memalign(COUNTERS_ALIGNMENT, size);
+    if(partial == NULL)
+        exitl("single_member.c", "allocCounters", EXIT_FAILURE, "echec allocation compteurs");
+    memset(partial, 0, size);
+    return partial;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Somme les nb_count premiers compteurs de chaque thread et libère les compteurs
+ *
+ * @return tableau des nb_count compteurs réduits
+ */
+unsigned *reduceCounters(unsigned *partial, unsigned stride, unsigned nb_count, unsigned nb_threads) {
+    unsigned *count = malloc((nb_count > 0 ? nb_count : 1) * sizeof(unsigned));
+    for(unsigned i = 0; i < nb_count; i++) {
+        count[i] = partial[i];
+        for(unsigned t = 1; t < nb_threads; t++)
+            count[i] += partial[(size_t)t * stride + i];
+    }
+    free(partial);
+    return count;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Exécute fun sur nb_threads threads avec des compteurs à zéro et somme les
+ * nb_count compteurs de chaque thread
+ *
+ * @return tableau des nb_count compteurs réduits
+ */
+unsigned *tallyParallel(fun_parallel fun, Bale *bale, List *finalists, unsigned nb_count, unsigned nb_threads) {
+    if(nb_threads < 1 || nb_threads > PARALLEL_MAX_THREADS)
+        exitl("single_member.c", "tallyParallel", EXIT_FAILURE, "nombre de threads invalide (%u)", nb_threads);
+
+    TallyParallel tally;
+    tally.bale = bale;
+    tally.finalists = finalists;
+    tally.stride = COUNTERS_STRIDE(nb_count);
+    tally.partial = allocCounters(nb_threads, tally.stride);
+
+    parallelRun(fun, nb_threads, &tally);
+    return reduceCounters(tally.partial, tally.stride, nb_count, nb_threads);
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Compte les premiers choix des lignes du thread id (fonction de thread)
+ */
+void firstRoundThread(unsigned id, unsigned nb_threads, void *arg) {
+    TallyParallel *tally = (TallyParallel*)arg;
+    unsigned begin, end;
+
+    parallelSplit(baleNbLine(tally->bale), id, nb_threads, &begin, &end);
+    baleCountFirstChoices(tally->bale, begin, end, tally->partial + (size_t)id * tally->stride);
+}
+
 /**
  * @author Alina IVANOVA
  * @date 21/11/2023 
  * @brief Calcul le nombre de voix pour chaque candidat
  * 
  * @param bale Ballot des votes
+ * @param nb_threads Nombre de threads du décompte
  * @return Tableau des scores par ordre des candidats dans le ballot
  */
-unsigned* voteCountFirstRound(Bale* bale){
-    unsigned nb_votes = baleNbVoter(bale);
-    unsigned nb_candidates = baleNbCandidat(bale);
-    unsigned* votesComplete = malloc(sizeof(int)*nb_candidates);
-    memset(votesComplete, 0, sizeof(int)*nb_candidates);
-    for (unsigned i = 0; i<nb_votes;i++){
-        //on recoit le liste avec le(les) candidat(s) qui a recu le val max a partir d'electeur i
-        GenList* winner = baleMin(bale, i, -1);
-        if (genListSize(winner)==1){//si on a qu'un seul candidat avec le note max, on prend en compte le vote
-            int cand = ((int*)genListGet(winner, 0))[2];//num de candidat avec le val max
-            votesComplete[cand] += 1;//on ajoute le vote
-        }
-        while(!genListEmpty(winner))
-            free(genListPop(winner));
-        deleteGenList(&winner);
-    }
-    return votesComplete;
+unsigned* voteCountFirstRound(Bale* bale, unsigned nb_threads){
+    /* premier choix unique de chaque ballot distinct, compté pour son poids */
+    return tallyParallel(firstRoundThread, bale, NULL, baleNbCandidat(bale), nb_threads);
 }
 
 
@@ -92,16 +190,15 @@ List* winnersOffirstRound(unsigned* scores, unsigned nb_candidat, unsigned nb_vo
  * @author Alina IVANOVA
  * @date 21/11/2023 
  */
-GenList* theWinnerOneRound(Bale* bale){
+GenList* theWinnerOneRoundParallel(Bale* bale, unsigned nb_threads){
     GenList *list = createGenList(1);
     WinnerSingle *winner;
-    char* winner_label;
     unsigned nb_candidat = baleNbCandidat(bale);
 
     if(nb_candidat == 0) return list;
 
     /* décompte des voies de chaque candidat */
-    unsigned* summaryOfVotes = voteCountFirstRound(bale);
+    unsigned* summaryOfVotes = voteCountFirstRound(bale, nb_threads);
 
     /* Récupération du nom du gagnant */
     List* winningCandidates = winnersOffirstRound(summaryOfVotes, nb_candidat, baleNbVoter(bale), 1);
@@ -112,9 +209,7 @@ GenList* theWinnerOneRound(Bale* bale){
         int winningCandidate = listGet(winningCandidates,i);
 
         /* récupération du label candidat */
-        winner_label = baleColumnToLabel(bale, winningCandidate);
-        strncpy(winner->name, winner_label, MAX_LENGHT_LABEL);
-        free(winner_label);
+        strncpy(winner->name, baleColumnToLabel(bale, winningCandidate), MAX_LENGHT_LABEL);
 
         /* calcul du score */
         winner->score = ((float)summaryOfVotes[winningCandidate]/baleNbVoter(bale)) * 100;
@@ -126,6 +221,13 @@ GenList* theWinnerOneRound(Bale* bale){
     return list;
 }
 
+/**
+ * @date 16/10/2026
+ */
+GenList* theWinnerOneRound(Bale* bale){
+    return theWinnerOneRoundParallel(bale, tallyNbThreads(bale));
+}
+
 /***********
 *   UNI2   *
 ***********/
@@ -166,37 +268,53 @@ int preferredCandidate(int* votes, unsigned nb_votes) {
 }
 
 /**
- * @name Ugo VALLAT
- * @date 30/11/2023
- * @brief Calcul les scores au second tour pour les candidats sélectionnés
- * 
- * @param b Ballot des scores 
- * @param winnersRound1 Gagnants du premier tour
- * @return Renvoie les tableau des scores (par ordre des gagnants du premier tour)
+ * @date 16/10/2026
+ * @brief Compte les voix du second tour des lignes du thread id (fonction de thread)
  */
-int* voteCountSecondRound(Bale *b, List* winnersRound1){
-    unsigned nb_winners = listSize(winnersRound1);
-    unsigned nb_voters = baleNbVoter(b);
-    int *count = malloc(sizeof(int)*nb_winners); /* tableau des scores */
+void secondRoundThread(unsigned id, unsigned nb_threads, void *arg) {
+    TallyParallel *tally = (TallyParallel*)arg;
+    Bale *b = tally->bale;
+    unsigned nb_winners = listSize(tally->finalists);
+    unsigned *count = tally->partial + (size_t)id * tally->stride;
     int votes[nb_winners]; /* tableau des votes d'une personne */
+    unsigned columns[nb_winners];
+    unsigned begin, end;
     int ind;
 
-    /* initialisation du tableau des scores */
     for(unsigned i = 0; i < nb_winners; i++)
-        count[i] = 0;
+        columns[i] = listGet(tally->finalists, i);
 
     /* pour chaque votant, recherche de son choix préféré */
-    for(unsigned l = 0; l < nb_voters; l++) {
+    parallelSplit(baleNbLine(b), id, nb_threads, &begin, &end);
+    for(unsigned l = begin; l < end; l++) {
         /* récupération des votes du votant pour chaque candidat sélectionné */
-        for(unsigned i = 0; i < nb_winners; i++) {
-            votes[i] = baleGetValue(b, l, listGet(winnersRound1, i));
-        }
+        for(unsigned i = 0; i < nb_winners; i++)
+            votes[i] = baleGetValue(b, l, columns[i]);
         /* Ajout du gagnant aux scores si il existe */
         ind = preferredCandidate(votes, nb_winners);
         if(ind != -1)
-            count[ind]++;
+            count[ind] += baleLineWeight(b, l);
     }
+}
 
+/**
+ * @name Ugo VALLAT
+ * @date 30/11/2023
+ * @brief Calcul les scores au second tour pour les candidats sélectionnés
+ * 
+ * @param b Ballot des scores 
+ * @param winnersRound1 Gagnants du premier tour
+ * @param nb_threads Nombre de threads du décompte
+ * @return Renvoie les tableau des scores (par ordre des gagnants du premier tour)
+ */
+int* voteCountSecondRound(Bale *b, List* winnersRound1, unsigned nb_threads){
+    unsigned nb_winners = listSize(winnersRound1);
+    unsigned *tally = tallyParallel(secondRoundThread, b, winnersRound1, nb_winners, nb_threads);
+    int *count = malloc(sizeof(int)*(nb_winners > 0 ? nb_winners : 1)); /* tableau des scores */
+
+    for(unsigned i = 0; i < nb_winners; i++)
+        count[i] = (int)tally[i];
+    free(tally);
     return count;
 }
 
@@ -232,26 +350,24 @@ List* winnerOfsecondRound(int* scores, unsigned nb_winners) {
  * @date 30/11/2023
  * @brief Récupère les information du candidat i est les stock dans une structure WinnerSingleTwo
  * 
- * @param b Ballot des votes 
+ * @param labels Labels des candidats
+ * @param nb_voters Nombre de votants
  * @param id Indentifiant du gagnant (numéro de colonne dans le ballot)
  * @param scores Nombre de votes pour le gagnant
  * @param round Tour
- * @pre baleNbVoter(b) != 0
+ * @pre nb_voters != 0
  * @return WinnerSingleTwo* 
  */
-WinnerSingleTwo* createWinnerInfo(Bale* b, unsigned id, int score, unsigned round) {
+WinnerSingleTwo* createWinnerInfo(LabelTable* labels, unsigned nb_voters, unsigned id, int score, unsigned round) {
     WinnerSingleTwo *winner;
-    char* winner_name;
     /* malloc du winner */
     winner = malloc(sizeof(WinnerSingleTwo));
 
     /* récupération du nom */
-    winner_name = baleColumnToLabel(b, id);
-    strncpy(winner->name, winner_name, MAX_LENGHT_LABEL);
-    free(winner_name);
+    strncpy(winner->name, labelTableGet(labels, id), MAX_LENGHT_LABEL);
 
     /* calcul du score en % */
-    winner->score = ((float)score / baleNbVoter(b))*100;
+    winner->score = ((float)score / nb_voters)*100;
 
     /* ajout du tour */
     winner->round = round;
@@ -260,62 +376,277 @@ WinnerSingleTwo* createWinnerInfo(Bale* b, unsigned id, int score, unsigned roun
 
 
 
-GenList* theWinnerTwoRounds(Bale* bale){
+/**
+ * @date 16/10/2026
+ * @brief Cherche les gagnants du premier tour et les ajoute à la liste des gagnants
+ *
+ * @param winners liste des gagnants à compléter
+ * @param labels labels des candidats
+ * @param nb_voters nombre de votants
+ * @param scores scores du premier tour (par ordre des candidats)
+ * @return finalistes (numéros de colonne), second tour seulement s'il y en a plusieurs
+ */
+List* addFirstRoundWinners(GenList* winners, LabelTable* labels, unsigned nb_voters, unsigned* scores) {
+    List* finalists = winnersOffirstRound(scores, labelTableSize(labels), nb_voters, 2);
+    unsigned id;
+
+    for(unsigned i = 0; i < listSize(finalists); i++) {
+        id = listGet(finalists, i);
+        genListAdd(winners, createWinnerInfo(labels, nb_voters, id, scores[id], 1));
+    }
+    return finalists;
+}
+
+/**
+ * @date 16/10/2026
+ * @brief Ajoute à la liste des gagnants tous les gagnants du second tour
+ *
+ * @param winners liste des gagnants à compléter
+ * @param labels labels des candidats
+ * @param nb_voters nombre de votants
+ * @param finalists finalistes du premier tour
+ * @param scores scores du second tour (par ordre des finalistes)
+ */
+void addSecondRoundWinners(GenList* winners, LabelTable* labels, unsigned nb_voters, List* finalists, int* scores) {
+    List* round_2_winners_pos = winnerOfsecondRound(scores, listSize(finalists));
+    unsigned pos;
+
+    while(!listEmpty(round_2_winners_pos)) {
+        pos = listRemove(round_2_winners_pos, 0);
+        genListAdd(winners, createWinnerInfo(labels, nb_voters, listGet(finalists, pos), scores[pos], 2));
+    }
+    deleteList(&round_2_winners_pos);
+}
+
+/**
+ * @date 16/10/2026
+ */
+GenList* theWinnerTwoRoundsParallel(Bale* bale, unsigned nb_threads){
     /* liste des vainqueurs (tour 1 et 2) */
     GenList *winners = createGenList(1);
-    
-    /* dimensions du ballot */
-    unsigned nb_candidat = baleNbCandidat(bale);
+    LabelTable *labels = baleLabels(bale);
     unsigned nb_voters = baleNbVoter(bale);
 
     /* si aucun candidat, retourne liste vide */
-    if(nb_candidat == 0) return winners;
+    if(baleNbCandidat(bale) == 0) return winners;
 
-    /* ### debut du premier tour ### */
-    unsigned* round_1_scores = voteCountFirstRound(bale);
-    List* round_1_winners_id = winnersOffirstRound(round_1_scores, nb_candidat, nb_voters,2);
+    /* ### premier tour ### */
+    unsigned* round_1_scores = voteCountFirstRound(bale, nb_threads);
+    List* finalists = addFirstRoundWinners(winners, labels, nb_voters, round_1_scores);
 
+    /* ### second tour, si plusieurs gagnants au premier ### */
+    if(listSize(finalists) > 1) {
+        int* round_2_scores = voteCountSecondRound(bale, finalists, nb_threads);
+        addSecondRoundWinners(winners, labels, nb_voters, finalists, round_2_scores);
+        free(round_2_scores);
+    }
 
-    unsigned nb_winners_round_1 = listSize(round_1_winners_id);
+    deleteList(&finalists);
+    free(round_1_scores);
+    return winners;
+}
 
-    /* On ajoute les gagnants du tour 1 à la liste des gagnants */
-    WinnerSingleTwo *winner1;
-    unsigned id_winner1;
-    for(unsigned i = 0; i < nb_winners_round_1; i++) {
-        id_winner1 = listGet(round_1_winners_id, i);
-        /* récupération des informations du gagnant */
-        winner1 = createWinnerInfo(bale, id_winner1, round_1_scores[id_winner1], 1);
-        /* ajout à la liste des gagnants */
-        genListAdd(winners, winner1);
+/**
+ * @date 16/10/2026
+ */
+GenList* theWinnerTwoRounds(Bale* bale){
+    return theWinnerTwoRoundsParallel(bale, tallyNbThreads(bale));
+}
+
+
+/*************************
+*   UNI2 (lecture csv)   *
+*************************/
+
+/**
+ * @date 16/10/2026
+ * @brief État d'un thread d'un décompte lu directement dans le csv (voir
+ * @ref csvForEachBallotParallel)
+ */
+typedef struct s_csv_tally {
+    unsigned nbc;               /* nombre de candidats */
+    bool summary;               /* premier tour : résumé des duels du second tour compté aussi */
+    const unsigned *columns;    /* colonnes des finalistes (second tour) */
+    unsigned nb_finalists;      /* nombre de finalistes (second tour) */
+    unsigned *count;            /* compteurs du thread */
+} CsvTally;
+
+
+/**
+ * @date 16/10/2026
+ * @brief Ajoute un votant au résumé des duels possibles du second tour
+ *
+ * Pour un couple ordonné (i, j) de finalistes possibles, @ref preferredCandidate sur les
+ * votes (v_i, v_j) annule le vote si v_i == v_j et choisit sinon j si v_i == -1 ou
+ * 0 < v_j < v_i (0 et les cases vides favorisent le candidat listé en premier). La matrice
+ * cast compte les votes exprimés (v_i != v_j, i < j seulement), la matrice second les voix de
+ * j : celles de i valent cast - second.
+ *
+ * @param ballot votes du votant (une case par candidat)
+ * @param nbc nombre de candidats
+ * @param cast, second matrices nbc x nbc des votes exprimés / des voix du candidat listé en second
+ */
+static inline void runoffAddBallot(const int *ballot, unsigned nbc, unsigned *restrict cast,
+                     unsigned *restrict second) {
+    unsigned *row;
+    int vote;
+
+    for(unsigned i = 0; i < nbc; i++) {
+        vote = ballot[i];
+        row = cast + (size_t)i * nbc;
+        for(unsigned j = i + 1; j < nbc; j++)
+            row[j] += ballot[j] != vote;
+
+        row = second + (size_t)i * nbc;
+        if(vote == -1) {
+            for(unsigned j = 0; j < nbc; j++)
+                row[j] += ballot[j] != -1;
+        } else if(vote > 0) {
+            /* 0 < v_j < vote en une comparaison non signée */
+            for(unsigned j = 0; j < nbc; j++)
+                row[j] += (unsigned)ballot[j] - 1 < (unsigned)vote - 1;
+        }
     }
+}
 
-    /* si un seul gagant (1 seul candidat), gagne directement */
-    if(nb_winners_round_1 <= 1) {
-        deleteList(&round_1_winners_id);
-        free(round_1_scores);
-        return winners;
+
+/**
+ * @date 16/10/2026
+ * @brief Compte le premier choix d'un votant et, si demandé, l'ajoute au résumé des duels
+ * (fonction de lecture)
+ *
+ * Compteurs : nbc premiers choix, puis les matrices cast et second de @ref runoffAddBallot
+ */
+void firstRoundBallot(const int *ballot, void *state) {
+    CsvTally *tally = (CsvTally*)state;
+    unsigned nbc = tally->nbc;
+    int first = ballotFirstChoice(ballot, nbc);
+
+    if(first >= 0) tally->count[first]++;
+    if(tally->summary)
+        runoffAddBallot(ballot, nbc, tally->count + nbc, tally->count + nbc + (size_t)nbc * nbc);
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Compte la voix d'un votant au second tour (fonction de lecture)
+ */
+void secondRoundBallot(const int *ballot, void *state) {
+    CsvTally *tally = (CsvTally*)state;
+    unsigned nb_finalists = tally->nb_finalists;
+    int votes[nb_finalists];
+    int ind;
+
+    for(unsigned i = 0; i < nb_finalists; i++)
+        votes[i] = ballot[tally->columns[i]];
+    ind = preferredCandidate(votes, nb_finalists);
+    if(ind != -1)
+        tally->count[ind]++;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Lit les votants du csv avec fun, chaque thread dans ses propres compteurs, et somme
+ * les nb_count compteurs de chaque thread
+ *
+ * @param file fichier csv (format ballot)
+ * @param fun fonction de lecture
+ * @param model état commun des threads (compteurs ignorés)
+ * @param nb_count nombre de compteurs
+ * @param[out] nb_voters nombre de votants lus (ignoré si NULL)
+ * @return tableau des nb_count compteurs réduits
+ */
+unsigned *csvTally(char *file, fun_ballot fun, CsvTally *model, unsigned nb_count, unsigned *nb_voters) {
+    unsigned nb_threads = csvNbThreads(file, "csvTally");
+    unsigned stride = COUNTERS_STRIDE(nb_count);
+    unsigned *partial = allocCounters(nb_threads, stride);
+    CsvTally tallies[nb_threads];
+    void *states[nb_threads];
+    unsigned nbl;
+
+    for(unsigned t = 0; t < nb_threads; t++) {
+        tallies[t] = *model;
+        tallies[t].count = partial + (size_t)t * stride;
+        states[t] = &tallies[t];
     }
+    nbl = csvForEachBallotParallel(file, fun, states, nb_threads);
+    if(nb_voters != NULL) *nb_voters = nbl;
+    return reduceCounters(partial, stride, nb_count, nb_threads);
+}
 
-    /* ### debut du second tour ### */
-    int* round_2_scores = voteCountSecondRound(bale,round_1_winners_id);
-    List* round_2_winners_pos = winnerOfsecondRound(round_2_scores , nb_winners_round_1);
 
-    /* ajout de tous les gagnants du second tour à la liste */
-    WinnerSingleTwo *winner2;
-    unsigned id_winner2;
-    while(!listEmpty(round_2_winners_pos)) {
-        /* récupération des informations du gagnant */
-        id_winner2 = listGet(round_1_winners_id, listGet(round_2_winners_pos, 0));
-        winner2 = createWinnerInfo(bale, id_winner2, round_2_scores[listRemove(round_2_winners_pos, 0)], 2);
-        /* ajout à la liste des gagnants */
-        genListAdd(winners, winner2);
+/**
+ * @date 16/10/2026
+ * @brief Scores du second tour entre deux finalistes lus dans le résumé des duels
+ *
+ * @param tally compteurs de @ref firstRoundBallot réduits
+ * @param nbc nombre de candidats
+ * @param finalists les deux finalistes, dans l'ordre du premier tour
+ * @return tableau des 2 scores (par ordre des finalistes)
+ */
+int* runoffScores(unsigned *tally, unsigned nbc, List *finalists) {
+    unsigned a = listGet(finalists, 0), b = listGet(finalists, 1);
+    unsigned cast = tally[nbc + (a < b ? a * nbc + b : b * nbc + a)];
+    int *count = malloc(2 * sizeof(int));
+    count[1] = (int)tally[nbc + nbc * nbc + a * nbc + b];
+    count[0] = (int)(cast - (unsigned)count[1]);
+    return count;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Calcul les scores au second tour des finalistes en relisant le csv
+ *
+ * @return tableau des scores (par ordre des finalistes)
+ */
+int* csvVoteCountSecondRound(char *file, unsigned nbc, List *finalists) {
+    unsigned nb_finalists = listSize(finalists);
+    unsigned columns[nb_finalists];
+    CsvTally model = {nbc, false, columns, nb_finalists, NULL};
+
+    for(unsigned i = 0; i < nb_finalists; i++)
+        columns[i] = listGet(finalists, i);
+    unsigned *tally = csvTally(file, secondRoundBallot, &model, nb_finalists, NULL);
+    int *count = malloc(sizeof(int) * nb_finalists);
+    for(unsigned i = 0; i < nb_finalists; i++)
+        count[i] = (int)tally[i];
+    free(tally);
+    return count;
+}
+
+
+/**
+ * @date 16/10/2026
+ */
+GenList* theWinnerTwoRoundsCsv(char *file, unsigned *nb_voters, unsigned *nb_candidats) {
+    GenList *winners = createGenList(1);
+    LabelTable *labels = csvBaleLabels(file);
+    unsigned nbc = labelTableSize(labels), nbv;
+    int* round_2_scores;
+
+    /* ### premier tour, avec le résumé des duels si peu de candidats ### */
+    CsvTally model = {nbc, nbc <= SINGLE_MAX_SUMMARY_CANDIDAT, NULL, 0, NULL};
+    unsigned nb_count = nbc + (model.summary ? 2 * nbc * nbc : 0);
+    unsigned *round_1_scores = csvTally(file, firstRoundBallot, &model, nb_count, &nbv);
+    List *finalists = addFirstRoundWinners(winners, labels, nbv, round_1_scores);
+
+    /* ### second tour : lu dans le résumé pour deux finalistes, sinon nouvelle lecture ### */
+    if(listSize(finalists) > 1) {
+        if(model.summary && listSize(finalists) == 2)
+            round_2_scores = runoffScores(round_1_scores, nbc, finalists);
+        else
+            round_2_scores = csvVoteCountSecondRound(file, nbc, finalists);
+        addSecondRoundWinners(winners, labels, nbv, finalists, round_2_scores);
+        free(round_2_scores);
     }
 
-    /* libération de la mémoire */
-    deleteList(&round_1_winners_id);
-    deleteList(&round_2_winners_pos);
+    if(nb_voters != NULL) *nb_voters = nbv;
+    if(nb_candidats != NULL) *nb_candidats = nbc;
+    deleteList(&finalists);
     free(round_1_scores);
-    free(round_2_scores);
-
+    deleteLabelTable(&labels);
     return winners;
-}
\ No newline at end of file
+}
@@ -49,6 +49,20 @@ typedef struct s_winner_single_two {
 */
 GenList* theWinnerOneRound(Bale* bale);
 
+/**
+ * @date 16/10/2026
+ * @brief @ref theWinnerOneRound avec un décompte réparti sur nb_threads threads (chaque
+ * thread compte une part des votants, les compteurs sont sommés ensuite)
+ *
+ * @param[in] bale matrice des ballots fournis pour chaque candidat
+ * @param[in] nb_threads nombre de threads
+ * @pre 1 <= nb_threads <= PARALLEL_MAX_THREADS
+ *
+ * @return Une liste de WinnerSingle, identique à celle de @ref theWinnerOneRound
+ * @note @ref theWinnerOneRound choisit le nombre de threads selon la taille du ballot
+ */
+GenList* theWinnerOneRoundParallel(Bale* bale, unsigned nb_threads);
+
 
 /**
  * @author IVANOVA ALina 
@@ -62,4 +76,37 @@ GenList* theWinnerOneRound(Bale* bale);
 */
 GenList* theWinnerTwoRounds(Bale* bale);
 
+/**
+ * @date 16/10/2026
+ * @brief @ref theWinnerTwoRounds avec les décomptes des deux tours répartis sur
+ * nb_threads threads
+ *
+ * @param[in] bale matrice des ballots fournis pour chaque candidat
+ * @param[in] nb_threads nombre de threads
+ * @pre 1 <= nb_threads <= PARALLEL_MAX_THREADS
+ *
+ * @return Retourne une liste de WinnerSingleTwo, identique à celle de @ref theWinnerTwoRounds
+ * @note @ref theWinnerTwoRounds choisit le nombre de threads selon la taille du ballot
+ */
+GenList* theWinnerTwoRoundsParallel(Bale* bale, unsigned nb_threads);
+
+/**
+ * @date 16/10/2026
+ * @brief @ref theWinnerTwoRounds lu directement dans un fichier csv de ballot, sans
+ * construire le ballot
+ *
+ * La lecture du premier tour compte aussi, s'il y a peu de candidats, les voix de chacun
+ * dans tous les duels possibles : le second tour entre deux finalistes est alors lu dans ce
+ * résumé sans relire le fichier. Sinon (beaucoup de candidats ou plus de deux finalistes), le
+ * fichier est relu pour le second tour.
+ *
+ * @param[in] file nom/path du fichier csv (format ballot)
+ * @param[out] nb_voters nombre de votants lus (ignoré si NULL)
+ * @param[out] nb_candidats nombre de candidats (ignoré si NULL)
+ *
+ * @return Retourne une liste de WinnerSingleTwo, identique à celle de @ref theWinnerTwoRounds
+ * sur le ballot du fichier
+ */
+GenList* theWinnerTwoRoundsCsv(char *file, unsigned *nb_voters, unsigned *nb_candidats);
+
 #endif
\ No newline at end of file
@@ -29,21 +29,14 @@
  * @date 21/11/2023 
  */
 int* voteCount(Bale* bale){
-    unsigned nb_votes = baleNbVoter(bale);
     unsigned nb_candidates = baleNbCandidat(bale);
-    int* votesComplete = malloc(sizeof(int)*nb_candidates);
-    memset(votesComplete, 0, sizeof(int)*nb_candidates);
-    for (unsigned i = 0; i<nb_votes;i++){
-        //on recoit le liste avec le(les) candidat(s) qui a recu le val max a partir d'electeur i
-        GenList* winner = baleMin(bale, i, -1);
-        if (genListSize(winner)==1){//si on a qu'un seul candidat avec le note max, on prend en compte le vote
-            int cand = ((int*)genListGet(winner, 0))[2];//num de candidat avec le val max
-            votesComplete[cand] += 1;//on ajoute le vote
-        }
-        while(!genListEmpty(winner))
-            free(genListPop(winner));
-        deleteGenList(&winner);
-    }
+    unsigned counts[nb_candidates > 0 ? nb_candidates : 1];
+    int* votesComplete = malloc(sizeof(int)*(nb_candidates > 0 ? nb_candidates : 1));
+    memset(counts, 0, sizeof(counts));
+    /* premier choix unique de chaque ballot distinct, compté pour son poids */
+    baleCountFirstChoices(bale, 0, baleNbLine(bale), counts);
+    for (unsigned i = 0; i < nb_candidates; i++)
+        votesComplete[i] = (int)counts[i];
     return votesComplete;
 }
 
@@ -79,7 +72,6 @@ void displayWinnerSingleMemberSingle(WinnerSingle *winner) {
 GenList* theWinnerOneRound(Bale* bale){
     GenList *list = createGenList(1);
     WinnerSingle *winner;
-    char* winner_label;
     unsigned nb_candidat = baleNbCandidat(bale);
 
     if(nb_candidat == 0) return list;
@@ -96,9 +88,7 @@ GenList* theWinnerOneRound(Bale* bale){
         int winningCandidate = listGet(winningCandidates,i);
 
         /* récupération du label candidat */
-        winner_label = baleColumnToLabel(bale, winningCandidate);
-        strncpy(winner->name, winner_label, MAX_LENGHT_LABEL);
-        free(winner_label);
+        strncpy(winner->name, baleColumnToLabel(bale, winningCandidate), MAX_LENGHT_LABEL);
 
         /* calcul du score */
         winner->score = ((float)summaryOfVotes[winningCandidate]/baleNbVoter(bale)) * 100;
@@ -34,22 +34,10 @@
  * @return Tableau des scores par ordre des candidats dans le ballot
  */
 unsigned* voteCountFirstRound(Bale* bale){
-    unsigned nb_votes = baleNbVoter(bale);
     unsigned nb_candidates = baleNbCandidat(bale);
-    unsigned* votesComplete = malloc(sizeof(unsigned)*nb_candidates);
-    memset(votesComplete, 0, sizeof(int)*nb_candidates);
-
-    for (unsigned i = 0; i<nb_votes;i++){
-        //on recoit le liste avec le(les) candidat(s) qui a recu le val max a partir d'electeur i
-        GenList* winner = baleMin(bale, i, -1);
-        if (genListSize(winner)==1){//si on a qu'un seul candidat avec le note max, on prend en compte le vote
-            int cand = ((int*)genListGet(winner, 0))[2];//num de candidat avec le val max
-            votesComplete[cand] += 1;//on ajoute le vote
-        }
-        while(!genListEmpty(winner))
-            free(genListPop(winner));
-        deleteGenList(&winner);
-    }
+    unsigned* votesComplete = calloc(nb_candidates > 0 ? nb_candidates : 1, sizeof(unsigned));
+    /* premier choix unique de chaque ballot distinct, compté pour son poids */
+    baleCountFirstChoices(bale, 0, baleNbLine(bale), votesComplete);
     return votesComplete;
 }
 
@@ -214,14 +202,11 @@ List* winnerOfsecondRound(int* scores, unsigned nb_winners) {
  */
 WinnerSingleTwo* createWinnerInfo(Bale* b, unsigned id, int score, unsigned round) {
     WinnerSingleTwo *winner;
-    char* winner_name;
     /* malloc du winner */
     winner = malloc(sizeof(WinnerSingleTwo));
 
     /* récupération du nom */
-    winner_name = baleColumnToLabel(b, id);
-    strncpy(winner->name, winner_name, MAX_LENGHT_LABEL);
-    free(winner_name);
+    strncpy(winner->name, baleColumnToLabel(b, id), MAX_LENGHT_LABEL);
 
     /* calcul du score en % */
     winner->score = ((float)score / baleNbVoter(b))*100;
@@ -24,13 +24,15 @@
 
 #include "data_struct_utils.h"
 #include "genericlist.h"
+#include "label_table.h"
 #include <stdbool.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include "bale.h"
-#include "matrix.h"
 #include <malloc.h>
 #include <string.h>
+#include <stdint.h>
+#include <limits.h>
 #include "../logger.h"
 
 
@@ -41,10 +43,127 @@
  */
 struct s_bale {
     int default_value;
-    GenList* labels;    /* Liste des labels */
-    Matrix* matrix;     /* Matrice contenant les données */
+    LabelTable* labels; /* Table des labels (partagée) */
+    void* cells;        /* Données ligne par ligne, cell_size octets par case */
+    unsigned cell_size; /* Taille d'une case (1, 2 ou 4 octets) */
+    unsigned nbl;       /* Nombre de lignes */
+    unsigned nbc;       /* Nombre de colonnes */
+    unsigned* weights;  /* Nombre de votants de chaque ligne */
+    unsigned nb_voter;  /* Nombre total de votants (somme des poids) */
 };
 
+
+/**
+ * @date 16/10/2026
+ * @brief Taille des cases d'un ballot de nbc candidats : un rang ou une note tient dans
+ * l'intervalle [-2, nbc] (ou [1, 6] pour un jugement), 8 bits suffisent jusqu'à 126 candidats
+ */
+unsigned cellSizeFor(unsigned nbc) {
+    if(nbc < INT8_MAX) return sizeof(int8_t);
+    if(nbc < INT16_MAX) return sizeof(int16_t);
+    return sizeof(int32_t);
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Lit la case i (indice ligne * nbc + colonne) et l'élargit en int
+ */
+static inline int cellGet(const Bale *b, size_t i) {
+    switch(b->cell_size) {
+        case sizeof(int8_t): return ((const int8_t*)b->cells)[i];
+        case sizeof(int16_t): return ((const int16_t*)b->cells)[i];
+        default: return ((const int32_t*)b->cells)[i];
+    }
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Écrit v dans la case i, v doit être représentable sur cell_size octets
+ */
+static inline void cellSet(Bale *b, size_t i, int v) {
+    switch(b->cell_size) {
+        case sizeof(int8_t): ((int8_t*)b->cells)[i] = (int8_t)v; break;
+        case sizeof(int16_t): ((int16_t*)b->cells)[i] = (int16_t)v; break;
+        default: ((int32_t*)b->cells)[i] = v;
+    }
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Plus petite taille de case qui peut stocker v
+ */
+unsigned cellSizeOf(int v) {
+    if(v >= INT8_MIN && v <= INT8_MAX) return sizeof(int8_t);
+    if(v >= INT16_MIN && v <= INT16_MAX) return sizeof(int16_t);
+    return sizeof(int32_t);
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Alloue les cases d'un ballot (nbl, nbc)
+ */
+void *allocCells(unsigned nbl, unsigned nbc, unsigned cell_size) {
+    size_t size = (size_t)nbl * nbc * cell_size;
+    return malloc(size > 0 ? size : 1);
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Élargit toutes les cases du ballot à cell_size octets, les valeurs sont conservées
+ */
+void widenCells(Bale *b, unsigned cell_size) {
+    size_t nb_cells = (size_t)b->nbl * b->nbc;
+    Bale wide = *b;
+
+    wide.cell_size = cell_size;
+    wide.cells = allocCells(b->nbl, b->nbc, cell_size);
+    for(size_t i = 0; i < nb_cells; i++)
+        cellSet(&wide, i, cellGet(b, i));
+    free(b->cells);
+    b->cells = wide.cells;
+    b->cell_size = cell_size;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Crée un ballot vide dont les cases font cell_size octets
+ */
+Bale *createBaleCells(unsigned int nbl, unsigned int nbc, LabelTable *labels, unsigned cell_size) {
+    Bale* bale = malloc(sizeof(Bale));
+    bale->labels = labelTableShare(labels);
+    bale->default_value = DEFAULT_VALUE;
+    bale->nbl = nbl;
+    bale->nbc = nbc;
+    bale->cell_size = cell_size;
+    bale->cells = allocCells(nbl, nbc, bale->cell_size);
+    for(size_t i = 0; i < (size_t)nbl * nbc; i++)
+        cellSet(bale, i, DEFAULT_VALUE);
+    bale->weights = malloc((nbl > 0 ? nbl : 1) * sizeof(unsigned));
+    for(unsigned l = 0; l < nbl; l++)
+        bale->weights[l] = 1;
+    bale->nb_voter = nbl;
+    return bale;
+}
+
+/**
+ * @date 16/10/2026
+ */
+Bale *createBaleFromTable(unsigned int nbl, unsigned int nbc, LabelTable *labels) {
+#ifdef DEBUG
+    testArgNull(labels, "bale.c", "createBaleFromTable", "labels");
+    if(labelTableSize(labels) != nbc)
+        exitl("bale.c", "createBaleFromTable", EXIT_FAILURE, "Nombre labels (%d) != nombre colonnes (%d)", labelTableSize(labels), nbc);
+#endif
+
+    return createBaleCells(nbl, nbc, labels, cellSizeFor(nbc));
+}
+
 /**
  * @date 13/11/2023
  * @author Ugo VALLAT
@@ -57,10 +176,9 @@ Bale *createBale(unsigned int nbl, unsigned int nbc, GenList *labels) {
         exitl("bale.c", "createBale", EXIT_FAILURE, "Nombre labels (%d) != nombre colonnes (%d)", genListSize(labels), nbc);
 #endif
 
-    Bale* bale = malloc(sizeof(Bale));
-    bale->labels = copyLabels(labels);
-    bale->matrix = createMatrix(nbl, nbc, DEFAULT_VALUE);
-    bale->default_value = DEFAULT_VALUE;
+    LabelTable *table = createLabelTable(labels);
+    Bale *bale = createBaleFromTable(nbl, nbc, table);
+    deleteLabelTable(&table);
     return bale;
 }
 
@@ -75,10 +193,9 @@ void deleteBale(ptrBale *b) {
     testArgNull(*b, "bale.c", "deleteBale", "*b");
 #endif
 
-    deleteMatrix(&(*b)->matrix);
-    while(!genListEmpty((*b)->labels))
-        free(genListPop((*b)->labels));
-    deleteGenList(&(*b)->labels);
+    free((*b)->cells);
+    free((*b)->weights);
+    deleteLabelTable(&(*b)->labels);
     free(*b);
     *b = NULL;
 }
@@ -91,10 +208,15 @@ void deleteBale(ptrBale *b) {
 Bale *baleSetValue(Bale *b, unsigned int l, unsigned int c, int v) {
 #ifdef DEBUG
     testArgNull(b, "bale.c", "baleSetValue", "b");
-    if(matrixGet(b->matrix, l, c) != b->default_value)
+    if(l >= b->nbl || c >= b->nbc)
+        exitl("bale.c", "baleSetValue", EXIT_FAILURE, "Position (%u,%u) invalide dans ballot (%u,%u)", l, c, b->nbl, b->nbc);
+    if(cellGet(b, (size_t)l * b->nbc + c) != b->default_value)
         exitl("bale.c", "baleSetValue", EXIT_FAILURE, "Impossible de modifier une valeur déjà set");
 #endif
-    matrixSet(b->matrix, l, c, v);
+    /* valeur inattendue (rang au-delà du nombre de candidats...) : les cases sont élargies */
+    if(cellSizeOf(v) > b->cell_size)
+        widenCells(b, cellSizeOf(v));
+    cellSet(b, (size_t)l * b->nbc + c, v);
     return b;
 }
 
@@ -106,9 +228,43 @@ Bale *baleSetValue(Bale *b, unsigned int l, unsigned int c, int v) {
 int baleGetValue(Bale *b, unsigned int l, unsigned int c) {
 #ifdef DEBUG
     testArgNull(b, "bale.c", "baleGetValue", "b");
+    if(l >= b->nbl || c >= b->nbc)
+        exitl("bale.c", "baleGetValue", EXIT_FAILURE, "Position (%u,%u) invalide dans ballot (%u,%u)", l, c, b->nbl, b->nbc);
 #endif
 
-    return matrixGet(b->matrix, l, c);
+    return cellGet(b, (size_t)l * b->nbc + c);
+}
+
+/**
+ * @date 16/10/2026
+ */
+void baleGetLine(Bale *b, unsigned int l, int *buff) {
+#ifdef DEBUG
+    testArgNull(b, "bale.c", "baleGetLine", "b");
+    testArgNull(buff, "bale.c", "baleGetLine", "buff");
+    if(l >= b->nbl)
+        exitl("bale.c", "baleGetLine", EXIT_FAILURE, "Ligne invalide (%u >= %u)", l, b->nbl);
+#endif
+    unsigned nbc = b->nbc;
+    size_t first = (size_t)l * nbc;
+
+    /* élargissement de la ligne (une boucle par largeur, vectorisable) */
+    switch(b->cell_size) {
+        case sizeof(int8_t): {
+            const int8_t *line = (const int8_t*)b->cells + first;
+            for(unsigned c = 0; c < nbc; c++)
+                buff[c] = line[c];
+            break;
+        }
+        case sizeof(int16_t): {
+            const int16_t *line = (const int16_t*)b->cells + first;
+            for(unsigned c = 0; c < nbc; c++)
+                buff[c] = line[c];
+            break;
+        }
+        default:
+            memcpy(buff, (const int32_t*)b->cells + first, nbc * sizeof(int));
+    }
 }
 
 /**
@@ -120,7 +276,57 @@ unsigned int baleNbVoter(Bale *b) {
     testArgNull(b, "bale.c", "baleNbVoter", "b");
 #endif
 
-    return matrixNbLines(b->matrix);
+    return b->nb_voter;
+}
+
+/**
+ * @date 16/10/2026
+ */
+unsigned int baleNbLine(Bale *b) {
+#ifdef DEBUG
+    testArgNull(b, "bale.c", "baleNbLine", "b");
+#endif
+
+    return b->nbl;
+}
+
+/**
+ * @date 16/10/2026
+ */
+unsigned int baleLineWeight(Bale *b, unsigned int l) {
+#ifdef DEBUG
+    testArgNull(b, "bale.c", "baleLineWeight", "b");
+    if(l >= b->nbl)
+        exitl("bale.c", "baleLineWeight", EXIT_FAILURE, "Ligne invalide (%u >= %u)", l, b->nbl);
+#endif
+
+    return b->weights[l];
+}
+
+/**
+ * @date 16/10/2026
+ */
+Bale *baleSetLineWeight(Bale *b, unsigned int l, unsigned int weight) {
+#ifdef DEBUG
+    testArgNull(b, "bale.c", "baleSetLineWeight", "b");
+    if(l >= b->nbl)
+        exitl("bale.c", "baleSetLineWeight", EXIT_FAILURE, "Ligne invalide (%u >= %u)", l, b->nbl);
+#endif
+
+    b->nb_voter += weight - b->weights[l];
+    b->weights[l] = weight;
+    return b;
+}
+
+/**
+ * @date 16/10/2026
+ */
+unsigned int baleCellSize(Bale *b) {
+#ifdef DEBUG
+    testArgNull(b, "bale.c", "baleCellSize", "b");
+#endif
+
+    return b->cell_size;
 }
 
 /**
@@ -132,7 +338,7 @@ unsigned int baleNbCandidat(Bale *b) {
     testArgNull(b, "bale.c", "baleNbCandidat", "b");
 #endif
 
-    return matrixNbColonnes(b->matrix);
+    return b->nbc;
 }
 
 
@@ -147,7 +353,9 @@ int baleLabelToColumn(Bale *b, char *label) {
     testArgNull(label, "bale.c", "baleLabelToColumn", "label");
 #endif
 
-    return searchLabel(b->labels, label);
+    if(strlen(label) > MAX_LENGHT_LABEL)
+        exitl("bale.c", "baleLabelToColumn", EXIT_FAILURE, "taille label %s > MAX_LENGHT_LABEL\n", label);
+    return labelTableSearch(b->labels, label);
 }
 
 /**
@@ -155,16 +363,25 @@ int baleLabelToColumn(Bale *b, char *label) {
  * @author Ugo VALLAT
  * @brief Renvoie le label associé à la colonne
  */
-char *baleColumnToLabel(Bale *b, unsigned int c) {
+const char *baleColumnToLabel(Bale *b, unsigned int c) {
 #ifdef DEBUG
     testArgNull(b, "bale.c", "baleColumnToLabel", "b");
-    if(c >= genListSize(b->labels))
+    if(c >= labelTableSize(b->labels))
         exitl("bale.c", "baleColumnToLabel", EXIT_FAILURE, "Argument c (%d) invalide\n", c);
 #endif
 
-    char* label = malloc(sizeof(char)*MAX_LENGHT_LABEL);
-    strncpy(label, genListGet(b->labels, c), MAX_LENGHT_LABEL);
-    return label;
+    return labelTableGet(b->labels, c);
+}
+
+/**
+ * @date 16/10/2026
+ */
+LabelTable *baleLabels(Bale *b) {
+#ifdef DEBUG
+    testArgNull(b, "bale.c", "baleLabels", "b");
+#endif
+
+    return b->labels;
 }
 
 
@@ -181,9 +398,101 @@ char *baleColumnToLabel(Bale *b, unsigned int c) {
 GenList *baleMin(Bale *b, int l, int c) {
 #ifdef DEBUG
     testArgNull(b, "bale.c", "baleMin", "b");
+    if (l >= (int)b->nbl || l < -1 || c >= (int)b->nbc || c < -1)
+        exitl("bale.c", "baleMin", EXIT_FAILURE,
+              "argument invalide (l,c)=(%d,%d) dans ballot (%d,%d)", l, c, b->nbl, b->nbc);
+#endif
+
+    /* parcours ligne par ligne de la zone demandée, les valeurs négatives sont ignorées */
+    GenList* lmin = createGenList(1);
+    unsigned l_begin = l == -1 ? 0 : (unsigned)l, l_end = l == -1 ? b->nbl : (unsigned)l + 1;
+    unsigned c_begin = c == -1 ? 0 : (unsigned)c, c_end = c == -1 ? b->nbc : (unsigned)c + 1;
+    int v, *cur;
+    for(unsigned i = l_begin; i < l_end; i++)
+        for(unsigned j = c_begin; j < c_end; j++) {
+            v = cellGet(b, (size_t)i * b->nbc + j);
+            if(v < 0) continue;
+            if(genListEmpty(lmin) || ((int*)genListGet(lmin, 0))[0] >= v) {
+                if(!genListEmpty(lmin) && ((int*)genListGet(lmin, 0))[0] > v)
+                    while(!genListEmpty(lmin))
+                        free(genListPop(lmin));
+                cur = malloc(sizeof(int)*3);
+                cur[0] = v;
+                cur[1] = i;
+                cur[2] = j;
+                genListAdd(lmin, cur);
+            }
+        }
+    return lmin;
+}
+
+/**
+ * @date 16/10/2026
+ * @brief Définit une fonction renvoyant la colonne du plus petit rang positif ou nul d'une
+ * ligne s'il est unique, -1 sinon.
+ *
+ * La ligne est lue en non signé : les valeurs négatives (non classé, case vide) deviennent
+ * plus grandes que tout rang valide (<= max_rank), le minimum et le nombre de cases égales se
+ * calculent alors par deux boucles sans branchement, vectorisables par le compilateur.
+ */
+#define DEFINE_FIRST_CHOICE(name, type, max_rank) \
+static inline int name(const type *row, unsigned nbc) { \
+    type min = (type)~(type)0; \
+    unsigned nb_min = 0, c = 0; \
+    for(unsigned j = 0; j < nbc; j++) \
+        min = row[j] < min ? row[j] : min; \
+    if(min > (max_rank)) return -1; \
+    for(unsigned j = 0; j < nbc; j++) \
+        nb_min += row[j] == min; \
+    if(nb_min != 1) return -1; \
+    while(row[c] != min) c++; \
+    return (int)c; \
+}
+
+DEFINE_FIRST_CHOICE(firstChoice8, uint8_t, INT8_MAX)
+DEFINE_FIRST_CHOICE(firstChoice16, uint16_t, INT16_MAX)
+DEFINE_FIRST_CHOICE(firstChoice32, uint32_t, INT32_MAX)
+
+
+/**
+ * @date 16/10/2026
+ */
+int ballotFirstChoice(const int *ballot, unsigned int nbc) {
+#ifdef DEBUG
+    testArgNull((void*)ballot, "bale.c", "ballotFirstChoice", "ballot");
 #endif
+    return firstChoice32((const uint32_t*)ballot, nbc);
+}
+
 
-    return matrixMin(b->matrix, l, c);
+/**
+ * @date 16/10/2026
+ * @brief Compte les premiers choix des lignes [l_begin, l_end[ pour une taille de case
+ */
+#define COUNT_FIRST_CHOICES(first_choice, type) \
+    for(unsigned l = l_begin; l < l_end; l++) { \
+        c = first_choice((const type*)b->cells + (size_t)l * nbc, nbc); \
+        if(c >= 0) count[c] += b->weights[l]; \
+    }
+
+/**
+ * @date 16/10/2026
+ */
+void baleCountFirstChoices(Bale *b, unsigned int l_begin, unsigned int l_end, unsigned *count) {
+#ifdef DEBUG
+    testArgNull(b, "bale.c", "baleCountFirstChoices", "b");
+    testArgNull(count, "bale.c", "baleCountFirstChoices", "count");
+    if(l_begin > l_end || l_end > b->nbl)
+        exitl("bale.c", "baleCountFirstChoices", EXIT_FAILURE, "Lignes [%u,%u[ invalides dans ballot (%u,%u)", l_begin, l_end, b->nbl, b->nbc);
+#endif
+
+    unsigned nbc = b->nbc;
+    int c;
+    switch(b->cell_size) {
+        case sizeof(int8_t): COUNT_FIRST_CHOICES(firstChoice8, uint8_t) break;
+        case sizeof(int16_t): COUNT_FIRST_CHOICES(firstChoice16, uint16_t) break;
+        default: COUNT_FIRST_CHOICES(firstChoice32, uint32_t)
+    }
 }
 
 /**
@@ -199,7 +508,88 @@ Bale *baleCopy(Bale *b) {
 
     Bale* cp = malloc(sizeof(Bale));
     cp->default_value = b->default_value;
-    cp->labels = copyLabels(b->labels);
-    cp->matrix = matrixCopy(b->matrix);
+    cp->labels = labelTableShare(b->labels);
+    unsigned nbl = b->nbl;
+    cp->nbl = nbl;
+    cp->nbc = b->nbc;
+    cp->cell_size = b->cell_size;
+    cp->cells = allocCells(nbl, b->nbc, b->cell_size);
+    memcpy(cp->cells, b->cells, (size_t)nbl * b->nbc * b->cell_size);
+    cp->weights = malloc((nbl > 0 ? nbl : 1) * sizeof(unsigned));
+    memcpy(cp->weights, b->weights, nbl * sizeof(unsigned));
+    cp->nb_voter = b->nb_voter;
     return cp;
 }
+
+
+/**
+ * @date 16/10/2026
+ * @brief Empreinte (FNV-1a) d'une ligne du ballot
+ */
+uint64_t hashLine(const unsigned char *line, size_t size) {
+    uint64_t hash = 14695981039346656037ULL;
+    for(size_t i = 0; i < size; i++) {
+        hash ^= line[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Compacte un ballot : chaque ballot distinct n'est stocké qu'une fois avec son poids
+ */
+Bale *baleCompact(Bale *b) {
+#ifdef DEBUG
+    testArgNull(b, "bale.c", "baleCompact", "b");
+#endif
+    unsigned nbl = b->nbl;
+    unsigned nbc = b->nbc;
+    size_t line_size = (size_t)nbc * b->cell_size;
+    const unsigned char *data = b->cells;
+
+    /* table de hachage (adressage ouvert) : indice du ballot distinct, UINT_MAX si vide */
+    size_t table_size = 16;
+    while(table_size < 2 * (size_t)nbl)
+        table_size *= 2;
+    unsigned *table = malloc(table_size * sizeof(unsigned));
+    for(size_t i = 0; i < table_size; i++)
+        table[i] = UINT_MAX;
+
+    /* première ligne et poids de chaque ballot distinct, dans l'ordre d'apparition */
+    unsigned *first = malloc((nbl > 0 ? nbl : 1) * sizeof(unsigned));
+    unsigned *weights = malloc((nbl > 0 ? nbl : 1) * sizeof(unsigned));
+    unsigned nb_unique = 0;
+    const unsigned char *line;
+    size_t h;
+
+    for(unsigned l = 0; l < nbl; l++) {
+        line = data + (size_t)l * line_size;
+        h = hashLine(line, line_size) & (table_size - 1);
+        while(table[h] != UINT_MAX && memcmp(data + (size_t)first[table[h]] * line_size, line, line_size) != 0)
+            h = (h + 1) & (table_size - 1);
+
+        if(table[h] == UINT_MAX) {
+            table[h] = nb_unique;
+            first[nb_unique] = l;
+            weights[nb_unique] = b->weights[l];
+            nb_unique++;
+        } else
+            weights[table[h]] += b->weights[l];
+    }
+
+    /* création du ballot compacté */
+    Bale *compact = createBaleCells(nb_unique, nbc, b->labels, b->cell_size);
+    unsigned char *compact_data = compact->cells;
+    for(unsigned u = 0; u < nb_unique; u++) {
+        memcpy(compact_data + (size_t)u * line_size, data + (size_t)first[u] * line_size, line_size);
+        compact->weights[u] = weights[u];
+    }
+    compact->nb_voter = b->nb_voter;
+
+    free(table);
+    free(first);
+    free(weights);
+    return compact;
+}
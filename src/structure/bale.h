@@ -19,6 +19,9 @@
  *
  * @remark Les dimensions d'un ballot sont fixes
  *
+ * @remark Les cases sont stockées sur 8, 16 ou 32 bits selon le nombre de candidats et les valeurs
+ * (voir @ref baleCellSize), les accesseurs renvoient toujours des int
+ *
  * @remark En cas d'erreur, toutes les fonctions du ballot exit le progamme avec un
  * message d'erreur
  */
@@ -36,6 +39,7 @@
 #include "data_struct_utils.h"
 #include <stdio.h>
 #include "data_struct_utils.h"
+#include "label_table.h"
 
 /**
  * @def DEFAULT_VALUE
@@ -68,10 +72,23 @@ typedef Bale *ptrBale;
  *
  * @return pointeur vers le ballot
  * @post Les labels sont ajoutés au colonne dans le même ordre que la liste
- * @remark Copie les labels dans le balot avec strncpy()
+ * @remark Copie les labels dans une nouvelle table de labels
  */
 Bale *createBale(unsigned int nbl, unsigned int nbc, GenList *labels);
 
+/**
+ * @date 16/10/2026
+ * @brief Crée un ballot dont les colonnes sont étiquetées par une table de labels existante
+ *
+ * @param[in] nbl Nombre de lignes de données (hors étiquettes)
+ * @param[in] nbc Nombre de colonnes de données (hors étiquettes)
+ * @param[in] labels Table des labels, partagée avec le ballot (pas de copie)
+ * @pre labels != NULL && labelTableSize(labels) == nbc
+ *
+ * @return pointeur vers le ballot
+ */
+Bale *createBaleFromTable(unsigned int nbl, unsigned int nbc, LabelTable *labels);
+
 /**
  * @date 5/11/2023
  * @brief Supprime le ballot et ses données en libérant la mémoire
@@ -94,6 +111,9 @@ void deleteBale(ptrBale *b);
  * @pre l < nb_ligne && c < nb_colonnes
  * @pre b != NULL
  * @pre value at (l,c) == ( @ref DEFAULT_VALUE )
+ * @note si v ne tient pas sur @ref baleCellSize octets, toutes les cases du ballot sont élargies
+ * @warning l'élargissement n'est pas protégé contre les accès concurrents : un remplissage
+ * parallèle doit écrire ces valeurs après la fin des threads
  *
  * @return Adresse du ballot
  */
@@ -114,9 +134,21 @@ Bale *baleSetValue(Bale *b, unsigned int l, unsigned int c, int v);
  */
 int baleGetValue(Bale *b, unsigned int l, unsigned int c);
 
+/**
+ * @date 16/10/2026
+ * @brief Copie la ligne l du ballot (classement d'un votant) dans buff
+ *
+ * @param[in] b Ballot à lire
+ * @param[in] l Ligne à copier
+ * @param[out] buff tableau de baleNbCandidat(b) entiers
+ * @pre l < nb_ligne
+ * @pre b != NULL && buff != NULL
+ */
+void baleGetLine(Bale *b, unsigned int l, int *buff);
+
 /**
  * @date 14/11/2023
- * @brief Renvoie le nombre de votants (nombre lignes)
+ * @brief Renvoie le nombre de votants (somme des poids des lignes)
  *
  * @param[in] b Ballot à utiliser
  * @pre b != NULL
@@ -125,6 +157,59 @@ int baleGetValue(Bale *b, unsigned int l, unsigned int c);
  */
 unsigned int baleNbVoter(Bale *b);
 
+/**
+ * @date 16/10/2026
+ * @brief Renvoie le nombre de lignes du ballot (ballots distincts si le ballot est compacté)
+ *
+ * @param[in] b Ballot à utiliser
+ * @pre b != NULL
+ *
+ * @return nombre de lignes
+ * @note les parcours votant par votant se font sur les lignes, en comptant chaque
+ * ligne @ref baleLineWeight fois
+ */
+unsigned int baleNbLine(Bale *b);
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie le poids de la ligne l (nombre de votants ayant ce ballot)
+ *
+ * @param[in] b Ballot à utiliser
+ * @param[in] l Ligne
+ * @pre b != NULL
+ * @pre l < nb_ligne
+ *
+ * @return poids de la ligne (1 si le ballot n'est pas compacté)
+ */
+unsigned int baleLineWeight(Bale *b, unsigned int l);
+
+/**
+ * @date 16/10/2026
+ * @brief Modifie le poids de la ligne l (nombre de votants ayant ce ballot)
+ *
+ * @param[in] b Ballot à modifier
+ * @param[in] l Ligne
+ * @param[in] weight nouveau poids
+ * @pre b != NULL
+ * @pre l < nb_ligne
+ *
+ * @return Adresse du ballot
+ */
+Bale *baleSetLineWeight(Bale *b, unsigned int l, unsigned int weight);
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie la taille en octets d'une case du ballot, choisie à la création selon le
+ * nombre de candidats : 1 octet jusqu'à 126 candidats, 2 jusqu'à 32766, 4 au-delà. Elle est
+ * élargie par @ref baleSetValue si une valeur n'y tient pas
+ *
+ * @param[in] b Ballot à utiliser
+ * @pre b != NULL
+ *
+ * @return taille d'une case (1, 2 ou 4)
+ */
+unsigned int baleCellSize(Bale *b);
+
 /**
  * @date 14/11/2023
  * @brief Renvoie le nombre de candidats (nombre colonnes)
@@ -147,9 +232,21 @@ unsigned int baleNbCandidat(Bale *b);
  * @pre c < nb_colonnes
  *
  * @return label
- * @note label retourné doit être free()
+ * @note label prêté, valide tant que le ballot existe, ne doit pas être free()
  */
-char *baleColumnToLabel(Bale *b, unsigned int c);
+const char *baleColumnToLabel(Bale *b, unsigned int c);
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie la table des labels du ballot, à partager avec @ref labelTableShare
+ * pour l'utiliser au-delà de la vie du ballot
+ *
+ * @param[in] b Ballot à utiliser
+ * @pre b != NULL
+ *
+ * @return table des labels (prêtée)
+ */
+LabelTable *baleLabels(Bale *b);
 
 /*------------------------------------------------------------------*/
 /*                            UTILS                                 */
@@ -169,6 +266,36 @@ char *baleColumnToLabel(Bale *b, unsigned int c);
  */
 GenList *baleMin(Bale *b, int l, int c);
 
+/**
+ * @date 16/10/2026
+ * @brief Compte le premier choix de chaque votant des lignes [l_begin, l_end[ : le candidat
+ * au plus petit rang positif ou nul de la ligne, s'il est unique (sinon le vote est ignoré)
+ *
+ * Équivalent à un appel de @ref baleMin par ligne, sans allocation : les lignes sont lues
+ * directement dans le ballot.
+ *
+ * @param[in] b Pointeur vers le ballot
+ * @param[in] l_begin Première ligne
+ * @param[in] l_end Ligne suivant la dernière
+ * @param[in,out] count tableau de baleNbCandidat(b) compteurs, le poids de chaque ligne
+ * est ajouté au compteur de son premier choix
+ * @pre b != NULL && count != NULL
+ * @pre l_begin <= l_end <= nb_ligne
+ */
+void baleCountFirstChoices(Bale *b, unsigned int l_begin, unsigned int l_end, unsigned *count);
+
+/**
+ * @date 16/10/2026
+ * @brief Premier choix d'un votant hors ballot, mêmes règles que @ref baleCountFirstChoices
+ *
+ * @param[in] ballot votes du votant (une case par candidat)
+ * @param[in] nbc nombre de candidats
+ * @pre ballot != NULL
+ *
+ * @return colonne du premier choix, -1 si aucun
+ */
+int ballotFirstChoice(const int *ballot, unsigned int nbc);
+
 
 /**
  * @date 5/11/2023
@@ -183,4 +310,18 @@ GenList *baleMin(Bale *b, int l, int c);
 Bale *baleCopy(Bale *b);
 
 
+/**
+ * @date 16/10/2026
+ * @brief Crée le ballot compacté de b : chaque ballot distinct n'est stocké qu'une fois,
+ * son poids est le nombre de votants l'ayant exprimé
+ *
+ * @param[in] b Pointeur vers le ballot source
+ * @pre b != NULL
+ *
+ * @return Pointeur vers le ballot compacté (même nombre de votants et de candidats)
+ * @note les lignes sont dans l'ordre de première apparition dans b
+ */
+Bale *baleCompact(Bale *b);
+
+
 #endif
\ No newline at end of file
@@ -10,8 +10,13 @@
 #include "matrix.h"
 #include <malloc.h>
 #include <string.h>
+#include <limits.h>
 #include "bale.h"
 #include "../logger.h"
+#include "../utils/parallel.h"
+
+/* nombre minimum de votants traités par chaque thread de duelFromBale */
+#define DUEL_MIN_VOTERS_PER_THREAD 1024
 
 
 
@@ -25,7 +30,7 @@
  */
 struct s_duel {
     int default_value;
-    GenList* labels;    /* Liste des labels */
+    LabelTable* labels; /* Table des labels (partagée) */
     Matrix* matrix;     /* Matrice contenant les données */
 };
 
@@ -43,12 +48,30 @@ Duel *createDuel(unsigned nb_candidats, GenList *labels) {
 
     Duel* duel = malloc(sizeof(Duel));
     duel->default_value = DEFAULT_VALUE;
-    duel->labels = copyLabels(labels);
+    duel->labels = createLabelTable(labels);
     duel->matrix = createMatrix(nb_candidats, nb_candidats, DEFAULT_VALUE);
     return duel;
 }
 
 
+/**
+ * @date 16/10/2026
+ */
+Duel *createEmptyDuel(unsigned nb_candidats, LabelTable *labels) {
+#ifdef DEBUG
+    testArgNull(labels, "duel.c", "createEmptyDuel", "labels");
+    if(labelTableSize(labels) != nb_candidats)
+        exitl("duel.c", "createEmptyDuel", EXIT_FAILURE, "Nombre labels (%d) != nombre colonnes (%d)", labelTableSize(labels), nb_candidats);
+#endif
+
+    Duel* duel = malloc(sizeof(Duel));
+    duel->default_value = DEFAULT_VALUE;
+    duel->labels = labelTableShare(labels);
+    duel->matrix = createMatrix(nb_candidats, nb_candidats, 0);
+    return duel;
+}
+
+
 /**
  * @author Ugo VALLAT
  * @date 30/11/2023
@@ -59,10 +82,7 @@ void deleteDuel(ptrDuel *d) {
     testArgNull(*d, "duel.c", "deleteDuel", "*d");
 #endif
     deleteMatrix(&((*d)->matrix));
-    while (!genListEmpty((*d)->labels)) {
-        free(genListPop((*d)->labels));
-    }
-    deleteGenList(&((*d)->labels));
+    deleteLabelTable(&((*d)->labels));
     free(*d);
     *d = NULL;
 }
@@ -117,7 +137,7 @@ unsigned int duelNbCandidat(Duel *d) {
  * @author Ugo VALLAT
  * @date 30/11/2023
 */
-char *duelIndexToLabel(Duel *d, unsigned int index) {
+const char *duelIndexToLabel(Duel *d, unsigned int index) {
 #ifdef DEBUG
     testArgNull(d, "duel.c", "duelIndexToLabel", "d");
     unsigned size = matrixNbColonnes(d->matrix);
@@ -126,50 +146,154 @@ char *duelIndexToLabel(Duel *d, unsigned int index) {
             index, size, size);
 #endif
 
-    char* label = malloc(sizeof(char)*MAX_LENGHT_LABEL);
-    strncpy(label, genListGet(d->labels, index), MAX_LENGHT_LABEL);
-    return label;
+    return labelTableGet(d->labels, index);
 }
 
 
-Duel* duelFromBale(Bale *b) {
+/**
+ * @date 16/10/2026
+ */
+LabelTable *duelLabels(Duel *d) {
 #ifdef DEBUG
-    testArgNull(b, "duel.c", "duelFromBale", "b");
+    testArgNull(d, "duel.c", "duelLabels", "d");
+#endif
+
+    return d->labels;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Clé de rang d'une case du ballot : l'ordre des clés est celui des préférences
+ * (plus petite clé = candidat préféré), -1 (non classé) a la plus grande clé
+ */
+#define RANK_KEY(v) ((v) == -1 ? UINT_MAX : (unsigned)(v) ^ 0x80000000u)
+
+
+/**
+ * @date 16/10/2026
+ */
+void duelAddBallot(Duel *d, const int *ballot, unsigned weight) {
+#ifdef DEBUG
+    testArgNull(d, "duel.c", "duelAddBallot", "d");
+    testArgNull((void*)ballot, "duel.c", "duelAddBallot", "ballot");
 #endif
-    unsigned nbl, nbc;
-    nbl = baleNbVoter(b);
-    nbc = baleNbCandidat(b);
-
-    /* récupération des labels */
-    GenList *labels = createGenList(nbc);
-    for(unsigned i = 0; i < nbc; i++) {
-        genListAdd(labels, baleColumnToLabel(b, i));
+    unsigned nbc = matrixNbColonnes(d->matrix);
+    int *scores = matrixData(d->matrix);
+    unsigned key[nbc > 0 ? nbc : 1];
+    unsigned key_x;
+    int *row;
+
+    /* classement du votant en clés de rang (égalités conservées) */
+    for(unsigned c = 0; c < nbc; c++)
+        key[c] = RANK_KEY(ballot[c]);
+
+    /* x bat tous les candidats de clé strictement supérieure : une ligne de scores
+     * augmentée sans branchement (boucle vectorisable), les non classés ne battent personne */
+    for(unsigned x = 0; x < nbc; x++) {
+        key_x = key[x];
+        if(key_x == UINT_MAX) continue;
+        row = scores + (size_t)x * nbc;
+        for(unsigned y = 0; y < nbc; y++)
+            row[y] += (int)((key[y] > key_x) * weight);
     }
+}
 
-    /* création de duel */
-    Duel* duel = malloc(sizeof(Duel));
-    duel->default_value = DEFAULT_VALUE;
-    duel->labels = labels;
-    duel->matrix = createMatrix(nbc, nbc, 0);
-
-    /* calcul des scores */
-    int score_x, score_y;
-    for(unsigned l = 0; l < nbl; l++) {
-        for(unsigned x = 0; x < nbc-1; x++) {
-            for(unsigned y = x + 1; y< nbc; y++) {
-                score_x = baleGetValue(b, l, x);
-                score_y = baleGetValue(b, l, y);
-                if(score_x!=score_y) {
-                    if(score_x == -1 || (score_y!=-1 && score_x>score_y))
-                        matrixSet(duel->matrix, y, x, matrixGet(duel->matrix, y, x)+1);
-                    else
-                        matrixSet(duel->matrix, x, y, matrixGet(duel->matrix, x, y)+1);
-                }
-            }
-        }
+
+/**
+ * @date 16/10/2026
+ */
+void duelAdd(Duel *d, Duel *src) {
+#ifdef DEBUG
+    testArgNull(d, "duel.c", "duelAdd", "d");
+    testArgNull(src, "duel.c", "duelAdd", "src");
+    if(matrixNbColonnes(d->matrix) != matrixNbColonnes(src->matrix))
+        exitl("duel.c", "duelAdd", EXIT_FAILURE, "Nombre de candidats différent (%u != %u)",
+            matrixNbColonnes(d->matrix), matrixNbColonnes(src->matrix));
+#endif
+    size_t size = (size_t)matrixNbColonnes(d->matrix) * matrixNbColonnes(d->matrix);
+    int *scores = matrixData(d->matrix);
+    const int *src_scores = matrixData(src->matrix);
+
+    for(size_t i = 0; i < size; i++)
+        scores[i] += src_scores[i];
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Contexte de conversion parallèle d'un ballot en duel
+ */
+typedef struct s_duel_parallel {
+    Bale *bale;         /* ballot à convertir */
+    Duel **partial;     /* matrice de duels de chaque thread */
+} DuelParallel;
+
+
+/**
+ * @date 16/10/2026
+ * @brief Compte les duels des votants du thread id dans sa matrice (fonction de thread)
+ */
+void duelFromBaleThread(unsigned id, unsigned nb_threads, void *arg) {
+    DuelParallel *duel_parallel = (DuelParallel*)arg;
+    Bale *b = duel_parallel->bale;
+    Duel *duel = duel_parallel->partial[id];
+    unsigned nbc = baleNbCandidat(b);
+    unsigned begin, end;
+    int ballot[nbc > 0 ? nbc : 1];
+
+    parallelSplit(baleNbLine(b), id, nb_threads, &begin, &end);
+    for(unsigned l = begin; l < end; l++) {
+        baleGetLine(b, l, ballot);
+        duelAddBallot(duel, ballot, baleLineWeight(b, l));
     }
+}
 
-    return duel;
 
+/**
+ * @author Ugo VALLAT
+ * @date 16/12/2023
+ */
+Duel* duelFromBale(Bale *b) {
+#ifdef DEBUG
+    testArgNull(b, "duel.c", "duelFromBale", "b");
+#endif
+    unsigned nb_threads = parallelNbThreads();
+    unsigned max_threads = baleNbLine(b) / DUEL_MIN_VOTERS_PER_THREAD;
+    if(max_threads < nb_threads)
+        nb_threads = max_threads < 1 ? 1 : max_threads;
+
+    return duelFromBaleParallel(b, nb_threads);
 }
 
+
+/**
+ * @date 16/10/2026
+ */
+Duel* duelFromBaleParallel(Bale *b, unsigned nb_threads) {
+#ifdef DEBUG
+    testArgNull(b, "duel.c", "duelFromBaleParallel", "b");
+#endif
+    if(nb_threads < 1 || nb_threads > PARALLEL_MAX_THREADS)
+        exitl("duel.c", "duelFromBaleParallel", EXIT_FAILURE, "nombre de threads invalide (%u)", nb_threads);
+    unsigned nbc = baleNbCandidat(b);
+
+    /* création d'une matrice de duels par thread (labels du ballot partagés),
+       le thread 0 remplit le résultat */
+    DuelParallel duel_parallel;
+    duel_parallel.bale = b;
+    duel_parallel.partial = malloc(nb_threads * sizeof(Duel*));
+    for(unsigned i = 0; i < nb_threads; i++)
+        duel_parallel.partial[i] = createEmptyDuel(nbc, baleLabels(b));
+
+    /* calcul des scores puis réduction */
+    parallelRun(duelFromBaleThread, nb_threads, &duel_parallel);
+    Duel *duel = duel_parallel.partial[0];
+    for(unsigned i = 1; i < nb_threads; i++) {
+        duelAdd(duel, duel_parallel.partial[i]);
+        deleteDuel(&duel_parallel.partial[i]);
+    }
+
+    free(duel_parallel.partial);
+    return duel;
+}
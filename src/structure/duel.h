@@ -63,6 +63,47 @@ typedef Duel *ptrDuel;
  */
 Duel *createDuel(unsigned int nb, GenList *labels);
 
+/**
+ * @date 16/10/2026
+ * @brief Crée une matrice de duels dont tous les scores sont à 0, à remplir
+ * votant par votant avec @ref duelAddBallot
+ *
+ * @param[in] nb Nombre de candidats
+ * @param[in] labels Table des labels, partagée avec la matrice de duels (pas de copie)
+ * @pre labels != NULL && labelTableSize(labels) == nb
+ *
+ * @return pointeur vers la matrice de duels
+ */
+Duel *createEmptyDuel(unsigned int nb, LabelTable *labels);
+
+/**
+ * @date 16/10/2026
+ * @brief Ajoute les préférences d'un ou plusieurs votants identiques aux scores de la
+ * matrice de duels
+ *
+ * Pour chaque paire de candidats (x,y), le score (x,y) est augmenté de weight si le
+ * ballot classe x strictement avant y (-1 : candidat non classé, battu par tous les autres).
+ *
+ * @param[in] d Matrice de duels à compléter
+ * @param[in] ballot classement du votant (une case par candidat)
+ * @param[in] weight nombre de votants ayant ce ballot (voir @ref baleLineWeight)
+ * @pre d != NULL && ballot != NULL
+ * @pre taille(ballot) == duelNbCandidat(d)
+ * @pre Forall c, ballot[c] < INT_MAX
+ */
+void duelAddBallot(Duel *d, const int *ballot, unsigned weight);
+
+/**
+ * @date 16/10/2026
+ * @brief Ajoute les scores de la matrice de duels src à ceux de d
+ *
+ * @param[in] d Matrice de duels à compléter
+ * @param[in] src Matrice de duels à ajouter
+ * @pre d != NULL && src != NULL
+ * @pre duelNbCandidat(d) == duelNbCandidat(src)
+ */
+void duelAdd(Duel *d, Duel *src);
+
 /**
  * @date 5/11/2023
  * @brief Supprime la matrice de duels et ses données en libérant la mémoire
@@ -124,8 +165,21 @@ unsigned int duelNbCandidat(Duel *d);
  * @pre c < nb_ligne
  *
  * @return Label associé
+ * @note label prêté, valide tant que la matrice de duels existe, ne doit pas être free()
  */
-char *duelIndexToLabel(Duel *d, unsigned int index);
+const char *duelIndexToLabel(Duel *d, unsigned int index);
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie la table des labels de la matrice de duels, à partager avec
+ * @ref labelTableShare pour l'utiliser au-delà de la vie de la matrice
+ *
+ * @param[in] d matrice de duels à utiliser
+ * @pre d != NULL
+ *
+ * @return table des labels (prêtée)
+ */
+LabelTable *duelLabels(Duel *d);
 
 
 
@@ -153,7 +207,24 @@ Duel *duelCopy(Duel *d);
  * 
  * @param[in] b Ballot à vonvertir
  * @return Duel* 
+ *
+ * @note les gros ballots sont convertis en parallèle (voir @ref duelFromBaleParallel)
  */
 Duel* duelFromBale(Bale *b);
 
+/**
+ * @date 16/10/2026
+ * @brief Converti un ballot en duel en répartissant les votants sur nb_threads threads
+ *
+ * Chaque thread compte les duels de ses votants dans sa propre matrice, les matrices
+ * sont ensuite additionnées : le résultat est identique à la conversion séquentielle.
+ *
+ * @param[in] b Ballot à vonvertir
+ * @param[in] nb_threads nombre de threads
+ * @pre b != NULL
+ * @pre 1 <= nb_threads <= @ref PARALLEL_MAX_THREADS
+ * @return Duel*
+ */
+Duel* duelFromBaleParallel(Bale *b, unsigned nb_threads);
+
 #endif
\ No newline at end of file
@@ -6,11 +6,14 @@
  * @brief Cette librairie implémente une liste générique pseudo statique d'entiers
  *
  * Implémente la liste sous forme d'un tableau statique et alloue
- * de la mémoire dynamiquement lorsque qu'il est plein
+ * de la mémoire dynamiquement lorsque qu'il est plein. La capacité double à chaque
+ * agrandissement (ajout en O(1) amorti) et n'est jamais réduite par une suppression
+ * (voir genListShrinkToFit)
  *
  * La liste ne contient que des pointeur génériques vers la donnée (void*)
  *
- * @note haute performance en lecture( O(1) ) mais faible en écriture ( O(n))
+ * @note haute performance en lecture( O(1) ) et en ajout en fin de liste ( O(1) amorti ),
+ * faible en insertion / suppression au milieu ( O(n) )
  *
  * @remark En cas d'erreur, toutes les fonctions de list exit le progamme avec un
  * message d'erreur
@@ -24,6 +27,10 @@
 #include <malloc.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
+
+/* capacité minimale ajoutée lors d'un agrandissement */
+#define MIN_GROWTH 8
 
 /*------------------------------------------------------------------*/
 /*                     STRUCTURE LIST GENERIC                       */
@@ -98,6 +105,19 @@ void adjustMemorySizeGenList(GenList *l, unsigned new_size) {
         exitl("genericlist.c", "adjustMemorySizeGenList", EXIT_FAILURE, "echec realloc tab");
 }
 
+/**
+ * @date 16/10/2026
+ * @brief Agrandit le tableau d'une liste pleine : la capacité double (au moins
+ * MIN_GROWTH éléments de plus)
+ *
+ * @param l Pointeur vers la liste
+ * @pre l != NULL
+ */
+void growGenList(GenList *l) {
+    unsigned grow = l->memory_size < MIN_GROWTH ? MIN_GROWTH : l->memory_size;
+    adjustMemorySizeGenList(l, l->memory_size + grow);
+}
+
 /**
  * @date  1/11/2023
  * @author Ugo VALLAT
@@ -110,7 +130,7 @@ void genListAdd(GenList *l, void *v) {
 
     /* agrandissement de la liste si pleine */
     if (l->size == l->memory_size)
-        adjustMemorySizeGenList(l, l->memory_size + 8);
+        growGenList(l);
 
     /* Ajout de la valeur */
     l->tab[l->size] = v;
@@ -131,11 +151,10 @@ void genListInsert(GenList *l, void *v, unsigned i) {
 
     /* agrandissement de la liste si pleine */
     if (l->size >= l->memory_size)
-        adjustMemorySizeGenList(l, l->memory_size + 8);
+        growGenList(l);
 
     /* décale tous les éléments */
-    for (int j = l->size - 1; j >= (int)i; j--)
-        l->tab[j + 1] = l->tab[j];
+    memmove(l->tab + i + 1, l->tab + i, (l->size - i) * sizeof(void *));
 
     /* ajoute le nouvel élément */
     l->tab[i] = v;
@@ -155,9 +174,9 @@ void* genListPop(GenList *l) {
 #endif
 
     /* suppression de l'élément */
+    /* la capacité est conservée (pas de realloc) */
     void* elem = l->tab[l->size-1];
     l->size--;
-    adjustMemorySizeGenList(l, l->size);
     return elem;
 }
 
@@ -174,11 +193,9 @@ void* genListRemove(GenList *l, unsigned i) {
 #endif
 
     void* elem = l->tab[i];
-    /* suppression de l'élément */
-    for (int j = i; j < (int)l->size - 1; j++)
-        l->tab[j] = l->tab[j + 1];
+    /* suppression de l'élément, la capacité est conservée */
+    memmove(l->tab + i, l->tab + i + 1, (l->size - i - 1) * sizeof(void *));
     l->size--;
-    adjustMemorySizeGenList(l, l->size);
     return elem;
 }
 
@@ -234,12 +251,48 @@ GenList *genListCopy(GenList *l) {
     GenList *new = createGenList(l->size);
 
     /* copie des éléments */
-    for (unsigned i = 0; i < l->size; i++)
-        genListAdd(new, l->tab[i]);
+    if (l->size > 0)
+        memcpy(new->tab, l->tab, l->size * sizeof(void *));
+    new->size = l->size;
 
     return new;
 }
 
+/**
+ * @date 16/10/2026
+ */
+void genListReserve(GenList *l, unsigned memory_size) {
+#ifdef DEBUG
+    testArgNull(l, "genericlist.c", "genListReserve", "l");
+#endif
+
+    if (memory_size > l->memory_size)
+        adjustMemorySizeGenList(l, memory_size);
+}
+
+/**
+ * @date 16/10/2026
+ */
+void genListShrinkToFit(GenList *l) {
+#ifdef DEBUG
+    testArgNull(l, "genericlist.c", "genListShrinkToFit", "l");
+#endif
+
+    if (l->size < l->memory_size)
+        adjustMemorySizeGenList(l, l->size);
+}
+
+/**
+ * @date 16/10/2026
+ */
+unsigned genListCapacity(GenList *l) {
+#ifdef DEBUG
+    testArgNull(l, "genericlist.c", "genListCapacity", "l");
+#endif
+
+    return l->memory_size;
+}
+
 /**
  * @date  1/11/2023
  * @author Ugo VALLAT
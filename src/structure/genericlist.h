@@ -6,11 +6,14 @@
  * @brief Cette librairie implémente une liste générique pseudo statique d'entiers
  *
  * Implémente la liste sous forme d'un tableau statique et alloue
- * de la mémoire dynamiquement lorsque qu'il est plein
+ * de la mémoire dynamiquement lorsque qu'il est plein. La capacité double à chaque
+ * agrandissement (ajout en O(1) amorti) et n'est jamais réduite par une suppression
+ * (voir genListShrinkToFit)
  *
  * La liste ne contient que des pointeur génériques vers la donnée (void*)
  *
- * @note haute performance en lecture( O(1) ) mais faible en écriture ( O(n))
+ * @note haute performance en lecture( O(1) ) et en ajout en fin de liste ( O(1) amorti ),
+ * faible en insertion / suppression au milieu ( O(n) )
  *
  * @remark En cas d'erreur, toutes les fonctions de liste générique exit le progamme avec un
  * message d'erreur
@@ -83,6 +86,7 @@ void genListInsert(GenList *l, void *v, unsigned i);
  *
  * @pre taille liste > 0
  * @return Valeur avant supression
+ * @note La capacité de la liste n'est pas réduite
  **/
 void* genListPop(GenList *l);
 
@@ -96,6 +100,7 @@ void* genListPop(GenList *l);
  *
  * @pre i < listSize
  * @return Valeur avant supression
+ * @note La capacité de la liste n'est pas réduite
  */
 void* genListRemove(GenList *l, unsigned i);
 
@@ -173,6 +178,37 @@ unsigned genListSize(GenList *l);
  */
 GenList *genListCopy(GenList *l);
 
+/**
+ * @date 16/10/2026
+ * @brief Réserve de la place pour au moins memory_size éléments, sans modifier la liste
+ *
+ * @param[in] l Pointeur vers la liste
+ * @param[in] memory_size Capacité minimale voulue (en nombre d'éléments)
+ * @pre l != NULL
+ * @note Ne réduit jamais la capacité
+ */
+void genListReserve(GenList *l, unsigned memory_size);
+
+/**
+ * @date 16/10/2026
+ * @brief Réduit la capacité de la liste à son nombre d'éléments
+ *
+ * @param[in] l Pointeur vers la liste
+ * @pre l != NULL
+ */
+void genListShrinkToFit(GenList *l);
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie la capacité de la liste (nombre d'éléments alloués)
+ *
+ * @param[in] l Pointeur vers la liste
+ * @pre l != NULL
+ *
+ * @return capacité de la liste
+ */
+unsigned genListCapacity(GenList *l);
+
 
 /*------------------------------------------------------------------*/
 /*                         ITERATEUR                                */
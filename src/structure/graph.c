@@ -22,7 +22,7 @@
 struct s_graph {
     int default_weight;
     unsigned nb_arc;    /* nombre d'arcs du graph */
-    GenList* labels;    /* Liste des labels */
+    LabelTable* labels; /* Table des labels (partagée) */
     Matrix* matrix;     /* Matrice contenant les données */
 };
 
@@ -37,9 +37,25 @@ Graph *createGraph(unsigned int nb_vertex, GenList *labels) {
         exitl("graph.c", "createGraph", EXIT_FAILURE, "Nombre labels (%d) != nombre sommets (%d)", genListSize(labels), nb_vertex);
 #endif
 
+    LabelTable *table = createLabelTable(labels);
+    Graph *graph = createGraphFromTable(nb_vertex, table);
+    deleteLabelTable(&table);
+    return graph;
+}
+
+/**
+ * @date 16/10/2026
+ */
+Graph *createGraphFromTable(unsigned int nb_vertex, LabelTable *labels) {
+#ifdef DEBUG
+    testArgNull(labels, "graph.c", "createGraphFromTable", "labels");
+    if(labelTableSize(labels) != nb_vertex)
+        exitl("graph.c", "createGraphFromTable", EXIT_FAILURE, "Nombre labels (%d) != nombre sommets (%d)", labelTableSize(labels), nb_vertex);
+#endif
+
     Graph* graph = malloc(sizeof(Graph));
     graph->default_weight = DEFAULT_WEIGHT;
-    graph->labels = copyLabels(labels);
+    graph->labels = labelTableShare(labels);
     graph->matrix = createMatrix(nb_vertex, nb_vertex, DEFAULT_VALUE);
     graph->nb_arc = 0;
     return graph;
@@ -56,9 +72,7 @@ void deleteGraph(ptrGraph *g) {
 #endif
 
     deleteMatrix(&(*g)->matrix);
-    while(!genListEmpty((*g)->labels))
-            free(genListPop((*g)->labels));
-    deleteGenList(&(*g)->labels);
+    deleteLabelTable(&(*g)->labels);
     free(*g);
     *g = NULL;
 }
@@ -176,7 +190,7 @@ unsigned int graphNbArc(Graph *g) {
  * @author Ugo VALLAT
  * @date  13/11/2023
  */
-char *graphGetLabel(Graph *g, unsigned int id) {
+const char *graphGetLabel(Graph *g, unsigned int id) {
 #ifdef DEBUG
     testArgNull(g, "graph.c", "graphGetLabel", "g");
     unsigned size = matrixNbColonnes(g->matrix);
@@ -184,9 +198,7 @@ char *graphGetLabel(Graph *g, unsigned int id) {
         exitl("graph.c", "graphGetLabel", EXIT_FAILURE, "Invalide sommet %d", id);
 #endif
 
-    char* label = malloc(sizeof(char) * MAX_LENGHT_LABEL);
-    strncpy(label, genListGet(g->labels, id), MAX_LENGHT_LABEL);
-    return label;
+    return labelTableGet(g->labels, id);
 }
 
 /**
@@ -220,53 +232,106 @@ Arc *graphGetArc(Graph *g, unsigned id_src, unsigned id_dest) {
 /*------------------------------------------------------------------*/
 
 
+Arc* copyArc(Arc* arc){
+    Arc* cp = malloc(sizeof(Arc));
+    cp->id_dest = arc->id_dest;
+    cp->id_src = arc->id_src;
+    cp->weight = arc->weight;
+    return cp;
+}
+
+
 /**
- * @author Corentin LUDWIG
- * @date  14/12/2023
+ * @date 16/10/2026
  */
-void genListAddSorted(GenList *l, Arc* e){
-    unsigned int i = 0;
-
-    while(genListSize(l) > i){
-        Arc *cur = genListGet(l, i);
-        if(cur->weight >= e->weight){
-            genListInsert(l, e,i);
-            return;
+void sortArcs(Arc *arcs, unsigned nb_arcs, int order) {
+#ifdef DEBUG
+    if(nb_arcs > 0) testArgNull(arcs, "graph.c", "sortArcs", "arcs");
+    if(order != ASCENDING && order != DESCENDING)
+        exitl("graph.c", "sortArcs", EXIT_FAILURE, "Ordre de tri invalide %d", order);
+#endif
+
+    Arc *src = arcs, *dest, *tmp;
+    unsigned width, left, mid, right, i, j, k;
+    bool first;
+
+    if(nb_arcs < 2) return;
+    dest = malloc(nb_arcs * sizeof(Arc));
+
+    /* fusion ascendante : séquences triées de largeur 1, 2, 4... */
+    for(width = 1; width < nb_arcs; width *= 2) {
+        for(left = 0; left < nb_arcs; left += 2 * width) {
+            mid = left + width < nb_arcs ? left + width : nb_arcs;
+            right = mid + width < nb_arcs ? mid + width : nb_arcs;
+            i = left; j = mid; k = left;
+            while(i < mid && j < right) {
+                /* à poids égal l'arc de gauche passe en premier (stabilité) */
+                first = order == DESCENDING ? src[i].weight >= src[j].weight
+                                            : src[i].weight <= src[j].weight;
+                dest[k++] = first ? src[i++] : src[j++];
+            }
+            while(i < mid) dest[k++] = src[i++];
+            while(j < right) dest[k++] = src[j++];
         }
-        i++;
+        tmp = src; src = dest; dest = tmp;
+    }
+
+    if(src != arcs) {
+        memcpy(arcs, src, nb_arcs * sizeof(Arc));
+        free(src);
     }
-    genListAdd(l, e);
+    else free(dest);
+}
+
+/**
+ * @date 16/10/2026
+ */
+Arc *graphToSortedArcs(Graph *g, int order, unsigned *nb_arcs) {
+#ifdef DEBUG
+    testArgNull(g, "graph.c", "graphToSortedArcs", "g");
+    testArgNull(nb_arcs, "graph.c", "graphToSortedArcs", "nb_arcs");
+#endif
+
+    unsigned nb_vertex = graphNbVertex(g);
+    Arc *arcs = malloc((g->nb_arc > 0 ? g->nb_arc : 1) * sizeof(Arc));
+    unsigned n = 0;
+    int weight;
+
+    /* extraction en une passe, dans l'ordre des lignes puis des colonnes */
+    for(unsigned i = 0; i < nb_vertex; i++) {
+        for(unsigned j = 0; j < nb_vertex; j++) {
+            weight = matrixGet(g->matrix, i, j);
+            if(weight == g->default_weight) continue;
+            arcs[n].id_src = i;
+            arcs[n].id_dest = j;
+            arcs[n].weight = weight;
+            n++;
+        }
     }
 
+    sortArcs(arcs, n, order);
+    *nb_arcs = n;
+    return arcs;
+}
+
 /**
  * @author Corentin LUDWIG
  * @date  14/12/2023
  */
-//TO DO gerer order
 GenList *graphToSortedList(Graph *g, int order){
-    (void)order;
-    unsigned int nb_vertex = graphNbVertex(g);
-    GenList *l = createGenList(graphNbArc(g));
-    for (unsigned int i = 0; i<nb_vertex; i++) {
-        for (unsigned int j = 0; j<nb_vertex; j++){
-            Arc *cur = graphGetArc(g,i,j);
-            if(cur != NULL){
-                genListAddSorted(l,cur);
-            }
-        }
-    }
-    return l;
-}
+#ifdef DEBUG
+    testArgNull(g, "graph.c", "graphToSortedList", "g");
+#endif
 
-Arc* copyArc(Arc* arc){
-    Arc* cp = malloc(sizeof(Arc));
-    cp->id_dest = arc->id_dest;
-    cp->id_src = arc->id_src;
-    cp->weight = arc->weight;
-    return cp;
+    unsigned nb_arcs;
+    Arc *arcs = graphToSortedArcs(g, order, &nb_arcs);
+    GenList *l = createGenList(nb_arcs > 0 ? nb_arcs : 1);
+    for(unsigned i = 0; i < nb_arcs; i++)
+        genListAdd(l, copyArc(&arcs[i]));
+    free(arcs);
+    return l;
 }
 
-
 /**
  * @author Corentin LUDWIG
  * @date  02/12/2023
@@ -22,6 +22,7 @@
 #define __GRAPH_H__
 #include "data_struct_utils.h"
 #include "genericlist.h"
+#include "label_table.h"
 #include "matrix.h"
 #include <errno.h>
 #include <stdbool.h>
@@ -72,6 +73,20 @@ typedef Graph *ptrGraph;
  */
 Graph *createGraph(unsigned int nb_vertex, GenList *labels);
 
+/**
+ * @date 16/10/2026
+ * @brief Crée un graph dont les sommets sont étiquetés par une table de labels existante
+ * (par exemple celle d'une matrice de duels, voir @ref duelLabels)
+ *
+ * @param[in] nb_vertex Nombre de sommets
+ * @param[in] labels Table des labels, partagée avec le graph (pas de copie)
+ *
+ * @pre labels != NULL && labelTableSize(labels) == nb_vertex
+ *
+ * @return pointeur vers le graph
+ */
+Graph *createGraphFromTable(unsigned int nb_vertex, LabelTable *labels);
+
 /**
  * @date 5/11/2023
  * @brief Supprime le graph et ses données en libérant la mémoire
@@ -169,8 +184,9 @@ unsigned int graphNbArc(Graph *g);
  * @pre g != NULL
  *
  * @return etiquette du sommet
+ * @note étiquette prêtée, valide tant que le graph existe, ne doit pas être free()
  */
-char *graphGetLabel(Graph *g, unsigned int id);
+const char *graphGetLabel(Graph *g, unsigned int id);
 
 
 /**
@@ -229,9 +245,39 @@ GenList *graphToList(Graph *g);
  * @pre order == @ref ASCENDING || order == @ref DESCENDING
  *
  * @return Liste générique des Arcs
+ * @remark À poids égal, les arcs restent dans l'ordre (sommet origine, sommet destination)
  */
 GenList *graphToSortedList(Graph *g, int order);
 
+/**
+ * @date 16/10/2026
+ * @brief Extrait tous les arcs du graphe dans un tableau contigu trié par ordre de poids
+ * croissant ( @ref ASCENDING ) ou décroissant ( @ref DESCENDING )
+ *
+ * @param[in] g Graph
+ * @param[in] order Ordre de tri
+ * @param[out] nb_arcs Nombre d'arcs du tableau
+ * @pre g != NULL
+ * @pre order == @ref ASCENDING || order == @ref DESCENDING
+ *
+ * @return Tableau des arcs (un seul bloc, à libérer avec free)
+ * @remark À poids égal, les arcs restent dans l'ordre (sommet origine, sommet destination)
+ */
+Arc *graphToSortedArcs(Graph *g, int order, unsigned *nb_arcs);
+
+/**
+ * @date 16/10/2026
+ * @brief Trie un tableau d'arcs par ordre de poids croissant ( @ref ASCENDING ) ou
+ * décroissant ( @ref DESCENDING ) (tri fusion stable, O(n log n))
+ *
+ * @param[in,out] arcs Tableau des arcs
+ * @param[in] nb_arcs Nombre d'arcs
+ * @param[in] order Ordre de tri
+ * @pre order == @ref ASCENDING || order == @ref DESCENDING
+ * @remark Le tri est stable : à poids égal, les arcs gardent leur ordre dans le tableau
+ */
+void sortArcs(Arc *arcs, unsigned nb_arcs, int order);
+
 /**
  * @brief Test si l'ajoue d'un arc crée un cycle dans le graph
  *
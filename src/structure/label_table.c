@@ -0,0 +1,133 @@
+/**
+ * @brief Table de labels partagée implémentation
+ */
+
+#include "label_table.h"
+#include "data_struct_utils.h"
+#include "genericlist.h"
+#include <stdlib.h>
+#include <string.h>
+#include "../logger.h"
+
+
+/**
+ * @date 16/10/2026
+ * @brief Définition de la structure table de labels
+ */
+struct s_label_table {
+    unsigned nb_owner;  /* nombre de structures partageant la table */
+    unsigned size;      /* nombre de labels */
+    char **labels;      /* début de chaque label dans text */
+    char *text;         /* labels bout à bout, terminés par '\0' */
+};
+
+
+/**
+ * @date 16/10/2026
+ * @brief Longueur d'un label, limitée à MAX_LENGHT_LABEL - 1 caractères
+ */
+size_t labelLength(const char *label) {
+    const char *end = memchr(label, '\0', MAX_LENGHT_LABEL);
+    return end != NULL ? (size_t)(end - label) : MAX_LENGHT_LABEL - 1;
+}
+
+
+/**
+ * @date 16/10/2026
+ */
+LabelTable *createLabelTable(GenList *labels) {
+    testArgNull(labels, "label_table.c", "createLabelTable", "labels");
+
+    unsigned size = genListSize(labels);
+    size_t text_size = 0;
+    for(unsigned i = 0; i < size; i++)
+        text_size += labelLength(genListGet(labels, i)) + 1;
+
+    LabelTable *t = malloc(sizeof(LabelTable));
+    if(t == NULL)
+        exitl("label_table.c", "createLabelTable", EXIT_FAILURE, "erreur malloc table");
+    t->nb_owner = 1;
+    t->size = size;
+    t->labels = malloc((size > 0 ? size : 1) * sizeof(char*));
+    t->text = malloc(text_size > 0 ? text_size : 1);
+    if(t->labels == NULL || t->text == NULL)
+        exitl("label_table.c", "createLabelTable", EXIT_FAILURE, "erreur malloc labels (%u)", size);
+
+    char *pos = t->text;
+    size_t len;
+    for(unsigned i = 0; i < size; i++) {
+        len = labelLength(genListGet(labels, i));
+        memcpy(pos, genListGet(labels, i), len);
+        pos[len] = '\0';
+        t->labels[i] = pos;
+        pos += len + 1;
+    }
+    return t;
+}
+
+/**
+ * @date 16/10/2026
+ */
+LabelTable *labelTableShare(LabelTable *t) {
+#ifdef DEBUG
+    testArgNull(t, "label_table.c", "labelTableShare", "t");
+#endif
+
+    t->nb_owner++;
+    return t;
+}
+
+/**
+ * @date 16/10/2026
+ */
+void deleteLabelTable(ptrLabelTable *t) {
+#ifdef DEBUG
+    testArgNull(t, "label_table.c", "deleteLabelTable", "t");
+    testArgNull(*t, "label_table.c", "deleteLabelTable", "*t");
+#endif
+
+    if(--(*t)->nb_owner == 0) {
+        free((*t)->labels);
+        free((*t)->text);
+        free(*t);
+    }
+    *t = NULL;
+}
+
+/**
+ * @date 16/10/2026
+ */
+unsigned int labelTableSize(LabelTable *t) {
+#ifdef DEBUG
+    testArgNull(t, "label_table.c", "labelTableSize", "t");
+#endif
+
+    return t->size;
+}
+
+/**
+ * @date 16/10/2026
+ */
+const char *labelTableGet(LabelTable *t, unsigned int i) {
+#ifdef DEBUG
+    testArgNull(t, "label_table.c", "labelTableGet", "t");
+    if(i >= t->size)
+        exitl("label_table.c", "labelTableGet", EXIT_FAILURE, "Indice (%u) invalide, %u labels", i, t->size);
+#endif
+
+    return t->labels[i];
+}
+
+/**
+ * @date 16/10/2026
+ */
+int labelTableSearch(LabelTable *t, const char *label) {
+    testArgNull(t, "label_table.c", "labelTableSearch", "t");
+    testArgNull((void*)label, "label_table.c", "labelTableSearch", "label");
+
+    for(unsigned i = 0; i < t->size; i++) {
+        if(strncmp(label, t->labels[i], MAX_LENGHT_LABEL) == 0)
+            return (int)i;
+    }
+    return -1;
+}
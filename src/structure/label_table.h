@@ -0,0 +1,100 @@
+/**
+ * @file label_table.h
+ * @brief Table de labels partagée entre les structures de données
+ *
+ * @brief Une table de labels stocke une seule fois les labels des candidats, dans un bloc
+ * mémoire contigu. Elle n'est pas modifiable après sa création.
+ *
+ * Les ballots, matrices de duels et graphes construits les uns à partir des autres
+ * partagent la même table (compteur de références) au lieu d'en copier les labels.
+ * Les labels sont prêtés : les pointeurs renvoyés par @ref labelTableGet restent valides
+ * tant que la table (ou une structure qui la partage) existe et ne doivent pas être libérés.
+ *
+ * @note Taille maximum des labels = @ref MAX_LENGHT_LABEL (fin de chaîne comprise)
+ *
+ * @warning Le partage et la suppression d'une table ne sont pas protégés contre les accès
+ * concurrents, la lecture des labels l'est
+ *
+ * @remark En cas d'erreur, toutes les fonctions de la table exit le progamme avec un
+ * message d'erreur
+ */
+
+#ifndef __LABEL_TABLE_H__
+#define __LABEL_TABLE_H__
+
+#include "genericlist.h"
+
+/* Définition opaque de la structure table de labels */
+typedef struct s_label_table LabelTable;
+typedef LabelTable *ptrLabelTable;
+
+/**
+ * @date 16/10/2026
+ * @brief Crée une table de labels à partir d'une liste de labels (copiés une seule fois)
+ *
+ * @param[in] labels Liste générique des labels (liste de char*)
+ * @pre labels != NULL && Forall x in labels, typeof(x) == char*
+ *
+ * @return pointeur vers la table, partagée par un seul propriétaire
+ * @post Les labels sont dans le même ordre que la liste
+ */
+LabelTable *createLabelTable(GenList *labels);
+
+/**
+ * @date 16/10/2026
+ * @brief Ajoute un propriétaire à la table
+ *
+ * @param[in] t table à partager
+ * @pre t != NULL
+ *
+ * @return t
+ * @post chaque partage doit être suivi d'un appel à @ref deleteLabelTable
+ */
+LabelTable *labelTableShare(LabelTable *t);
+
+/**
+ * @date 16/10/2026
+ * @brief Retire un propriétaire à la table, la table est libérée avec son dernier propriétaire
+ *
+ * @param[in] t table à abandonner
+ * @pre t != NULL
+ * @pre *t != NULL
+ * @post *t == NULL
+ */
+void deleteLabelTable(ptrLabelTable *t);
+
+/**
+ * @date 16/10/2026
+ * @param[in] t table de labels
+ * @pre t != NULL
+ *
+ * @return Nombre de labels
+ */
+unsigned int labelTableSize(LabelTable *t);
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie le label d'indice i (prêté, ne pas libérer)
+ *
+ * @param[in] t table de labels
+ * @param[in] i indice du label
+ * @pre t != NULL
+ * @pre i < labelTableSize(t)
+ *
+ * @return label d'indice i
+ */
+const char *labelTableGet(LabelTable *t, unsigned int i);
+
+/**
+ * @date 16/10/2026
+ * @brief Cherche un label dans la table
+ *
+ * @param[in] t table de labels
+ * @param[in] label label à chercher
+ * @pre t != NULL && label != NULL
+ *
+ * @return indice du label dans la table, -1 si introuvable
+ */
+int labelTableSearch(LabelTable *t, const char *label);
+
+#endif
@@ -6,7 +6,9 @@
  * @brief Implémentation de la liste pseudo statique d'entiers
  *
  * Implémente la liste sous forme d'un tableau statique et alloue
- * de la mémoire dynamiquement lorsque qu'il est plein
+ * de la mémoire dynamiquement lorsque qu'il est plein. La capacité double à chaque
+ * agrandissement (ajout en O(1) amorti) et n'est jamais réduite par une suppression
+ * (voir listShrinkToFit)
  *
  * @remark En cas d'erreur, toutes les fonctions de list exit le progamme avec un
  * message d'erreur
@@ -19,6 +21,10 @@
 #include <malloc.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
+
+/* capacité minimale ajoutée lors d'un agrandissement */
+#define MIN_GROWTH 8
 
 /*------------------------------------------------------------------*/
 /*                        STRUCTURE LIST                            */
@@ -88,6 +94,21 @@ void adjustMemorySizeList(List *l, unsigned new_size) {
         exitl("list.c", "adjustMemorySizeList", EXIT_FAILURE, "echec realloc tab");
 }
 
+/**
+ * @date 16/10/2026
+ * @brief Agrandit le tableau pour contenir au moins min_size éléments : la capacité
+ * double (au moins MIN_GROWTH éléments de plus)
+ *
+ * @param l Pointeur vers la liste
+ * @param min_size Capacité minimale nécessaire
+ * @pre l != NULL
+ */
+void growList(List *l, unsigned min_size) {
+    unsigned grow = l->memory_size < MIN_GROWTH ? MIN_GROWTH : l->memory_size;
+    unsigned new_size = l->memory_size + grow;
+    adjustMemorySizeList(l, new_size < min_size ? min_size : new_size);
+}
+
 /**
  * @date  1/11/2023
  * @author Ugo VALLAT
@@ -100,7 +121,7 @@ void listAdd(List *l, int v) {
 
     /* agrandissement de la liste si pleine */
     if (l->size == l->memory_size)
-        adjustMemorySizeList(l, l->memory_size + 8);
+        growList(l, l->size + 1);
 
     /* Ajout de la valeur */
     l->tab[l->size] = v;
@@ -121,11 +142,10 @@ void listInsert(List *l, int v, unsigned i) {
 
     /* agrandissement de la liste si pleine */
     if (l->size >= l->memory_size)
-        adjustMemorySizeList(l, l->memory_size + 8);
+        growList(l, l->size + 1);
 
     /* décale tous les éléments */
-    for (int j = l->size - 1; j >= (int)i; j--)
-        l->tab[j + 1] = l->tab[j];
+    memmove(l->tab + i + 1, l->tab + i, (l->size - i) * sizeof(int));
 
     /* ajoute le nouvel élément */
     l->tab[i] = v;
@@ -145,9 +165,9 @@ int listPop(List *l) {
 #endif
 
     /* suppression de l'élément */
+    /* la capacité est conservée (pas de realloc) */
     int elem = l->tab[l->size-1];
     l->size--;
-    adjustMemorySizeList(l, l->size);
     return elem;
 }
 
@@ -165,11 +185,9 @@ int listRemove(List *l, unsigned i) {
 
     int elem = l->tab[i];
 
-    /* suppression de l'élément */
-    for (int j = i; j < (int)l->size - 1; j++)
-        l->tab[j] = l->tab[j + 1];
+    /* suppression de l'élément, la capacité est conservée */
+    memmove(l->tab + i, l->tab + i + 1, (l->size - i - 1) * sizeof(int));
     l->size--;
-    adjustMemorySizeList(l, l->size);
 
     return elem;
 }
@@ -212,9 +230,7 @@ List *listCopy(List *l) {
     List *new = createList(l->size);
 
     /* copie des éléments */
-    for (unsigned i = 0; i < l->size; i++) {
-        listAdd(new, l->tab[i]);
-    }
+    listAppendArray(new, l->tab, l->size);
     return new;
 }
 
@@ -255,3 +271,82 @@ void listClear(List *l) {
 }
 
 
+/**
+ * @date 16/10/2026
+ */
+void listReserve(List *l, unsigned memory_size) {
+#ifdef DEBUG
+    testArgNull(l, "list.c", "listReserve", "l");
+#endif
+
+    if (memory_size > l->memory_size)
+        adjustMemorySizeList(l, memory_size);
+}
+
+/**
+ * @date 16/10/2026
+ */
+void listShrinkToFit(List *l) {
+#ifdef DEBUG
+    testArgNull(l, "list.c", "listShrinkToFit", "l");
+#endif
+
+    if (l->size < l->memory_size)
+        adjustMemorySizeList(l, l->size);
+}
+
+/**
+ * @date 16/10/2026
+ */
+unsigned listCapacity(List *l) {
+#ifdef DEBUG
+    testArgNull(l, "list.c", "listCapacity", "l");
+#endif
+
+    return l->memory_size;
+}
+
+/**
+ * @date 16/10/2026
+ */
+void listFill(List *l, int v, unsigned n) {
+#ifdef DEBUG
+    testArgNull(l, "list.c", "listFill", "l");
+#endif
+
+    if (l->size + n > l->memory_size)
+        growList(l, l->size + n);
+
+    int *dest = l->tab + l->size;
+    for (unsigned i = 0; i < n; i++)
+        dest[i] = v;
+    l->size += n;
+}
+
+/**
+ * @date 16/10/2026
+ */
+void listAppendArray(List *l, const int *values, unsigned n) {
+#ifdef DEBUG
+    testArgNull(l, "list.c", "listAppendArray", "l");
+    if (n > 0) testArgNull((void*)values, "list.c", "listAppendArray", "values");
+#endif
+
+    if (n == 0) return;
+    if (l->size + n > l->memory_size)
+        growList(l, l->size + n);
+
+    memcpy(l->tab + l->size, values, n * sizeof(int));
+    l->size += n;
+}
+
+/**
+ * @date 16/10/2026
+ */
+int *listData(List *l) {
+#ifdef DEBUG
+    testArgNull(l, "list.c", "listData", "l");
+#endif
+
+    return l->tab;
+}
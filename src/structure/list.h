@@ -5,9 +5,12 @@
  * @brief Cette librairie implémente une liste pseudo statique d'entiers
  *
  * Implémente la liste sous forme d'un tableau statique et alloue
- * de la mémoire dynamiquement lorsque qu'il est plein
+ * de la mémoire dynamiquement lorsque qu'il est plein. La capacité double à chaque
+ * agrandissement (ajout en O(1) amorti) et n'est jamais réduite par une suppression
+ * (voir listShrinkToFit)
  *
- * @note haute performance en lecture( O(1) ) mais faible en écriture ( O(n))
+ * @note haute performance en lecture( O(1) ) et en ajout en fin de liste ( O(1) amorti ),
+ * faible en insertion / suppression au milieu ( O(n) )
  *
  * @remark En cas d'erreur, toutes les fonctions de liste exit le progamme avec un
  * message d'erreur
@@ -165,4 +168,70 @@ List *listCopy(List *l);
  */
 void listClear(List *l);
 
+/**
+ * @date 16/10/2026
+ * @brief Réserve de la place pour au moins memory_size éléments, sans modifier la liste
+ *
+ * @param[in] l Pointeur vers la liste
+ * @param[in] memory_size Capacité minimale voulue (en nombre d'éléments)
+ * @pre l != NULL
+ * @note Ne réduit jamais la capacité
+ */
+void listReserve(List *l, unsigned memory_size);
+
+/**
+ * @date 16/10/2026
+ * @brief Réduit la capacité de la liste à son nombre d'éléments
+ *
+ * @param[in] l Pointeur vers la liste
+ * @pre l != NULL
+ */
+void listShrinkToFit(List *l);
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie la capacité de la liste (nombre d'éléments alloués)
+ *
+ * @param[in] l Pointeur vers la liste
+ * @pre l != NULL
+ *
+ * @return capacité de la liste
+ */
+unsigned listCapacity(List *l);
+
+/**
+ * @date 16/10/2026
+ * @brief Ajoute n fois la valeur v à la fin de la liste (un seul agrandissement)
+ *
+ * @param[in] l Pointeur vers la liste
+ * @param[in] v Valeur à ajouter
+ * @param[in] n Nombre d'ajouts
+ * @pre l != NULL
+ */
+void listFill(List *l, int v, unsigned n);
+
+/**
+ * @date 16/10/2026
+ * @brief Ajoute les n valeurs du tableau à la fin de la liste (un seul agrandissement)
+ *
+ * @param[in] l Pointeur vers la liste
+ * @param[in] values Tableau des valeurs
+ * @param[in] n Nombre de valeurs
+ * @pre l != NULL
+ * @pre n == 0 || values != NULL
+ */
+void listAppendArray(List *l, const int *values, unsigned n);
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie le tableau des valeurs de la liste (listSize(l) valeurs contiguës)
+ *
+ * @param[in] l Pointeur vers la liste
+ * @pre l != NULL
+ *
+ * @return pointeur vers la première valeur
+ * @warning Pointeur invalidé par tout ajout pouvant agrandir la liste
+ */
+int *listData(List *l);
+
 #endif
\ No newline at end of file
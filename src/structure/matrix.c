@@ -19,13 +19,16 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "../logger.h"
 #include "data_struct_utils.h"
 #include "genericlist.h"
-#include "list.h"
 #include "matrix.h"
 
+/* Alignement du tableau des valeurs (taille d'une ligne de cache) */
+#define MATRIX_ALIGNMENT 64
+
 /*------------------------------------------------------------------*/
 /*                        STRUCTURE MATRIX                           */
 /*------------------------------------------------------------------*/
@@ -35,15 +38,71 @@
  * @author Ugo VALLAT
  * @brief Définition de la structure matrice
  *
- * @remark Implémentation sous forme d'une liste de liste
+ * @remark Implémentation sous forme d'un unique tableau contigu, ligne par ligne
+ * (case (l,c) à l'indice l*nbc+c), aligné sur une ligne de cache
  */
 struct s_matrix {
-    int default_value; /* Valeur par défault d'une case "vide" */
-    unsigned int nbl;  /* nombre de lignes */
-    unsigned int nbc;  /* nombre de colonnes */
-    GenList *tab;      /* liste générique de lignes */
+    int default_value;  /* Valeur par défault d'une case "vide" */
+    unsigned int nbl;   /* nombre de lignes */
+    unsigned int nbc;   /* nombre de colonnes */
+    size_t memory_size; /* nombre de cases allouées */
+    int *tab;           /* tableau des valeurs (nbl*nbc cases utilisées) */
 };
 
+/**
+ * @date  16/10/2026
+ * @brief Alloue un tableau de cases aligné sur une ligne de cache
+ *
+ * @param[in] size Nombre de cases
+ * @return pointeur vers le tableau (NULL si size == 0)
+ */
+int *allocMatrixTab(size_t size) {
+    if (size == 0)
+        return NULL;
+    int *tab = memalign(MATRIX_ALIGNMENT, size * sizeof(int));
+    if (tab == NULL)
+        exitl("matrix.c", "allocMatrixTab", EXIT_FAILURE, "echec allocation tableau");
+    return tab;
+}
+
+/**
+ * @date  16/10/2026
+ * @brief Remplit n cases consécutives avec la valeur par défault
+ *
+ * @param[in] m Pointeur vers la matrice
+ * @param[in] tab Première case à remplir
+ * @param[in] n Nombre de cases
+ */
+void fillDefaultMatrix(Matrix *m, int *tab, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        tab[i] = m->default_value;
+}
+
+/**
+ * @date  16/10/2026
+ * @brief Garantit qu'au moins size cases sont allouées, le tableau grandit
+ * géométriquement pour que les insertions successives restent en O(1) amorti
+ *
+ * @param[in] m Pointeur vers la matrice
+ * @param[in] size Nombre de cases nécessaires
+ * @return true si le tableau a été réalloué (les cases utilisées sont conservées)
+ */
+bool reserveMatrix(Matrix *m, size_t size) {
+    if (size <= m->memory_size)
+        return false;
+    size_t new_size = 2 * m->memory_size;
+    if (new_size < size)
+        new_size = size;
+
+    int *tab = allocMatrixTab(new_size);
+    if (m->tab != NULL)
+        memcpy(tab, m->tab, (size_t)m->nbl * m->nbc * sizeof(int));
+    free(m->tab);
+    m->tab = tab;
+    m->memory_size = new_size;
+    return true;
+}
+
 /**
  * @date  1/11/2023
  * @author Ugo VALLAT
@@ -54,26 +113,14 @@ Matrix *createMatrix(unsigned int nbl, unsigned int nbc, int default_value) {
     if (m == NULL)
         exitl("matrix.c", "createMatrix", EXIT_FAILURE, "Echec malloc matrice");
 
-    /* création liste de lignes (liste générique) */
-    m->tab = createGenList(nbl);
-
-    /* création des lignes */
-    List *l;
-    for (unsigned int i = 0; i < nbl; i++) {
-        /* créer une ligne */
-        l = createList(nbc);
-
-        /* remplir la ligne */
-        for (unsigned int j = 0; j < nbc; j++)
-            listAdd(l, default_value);
-
-        /* ajouter ligne à la matrice */
-        genListAdd(m->tab, l);
-    }
-
     m->default_value = default_value;
     m->nbl = nbl;
     m->nbc = nbc;
+
+    /* création du tableau de valeurs */
+    m->memory_size = (size_t)nbl * nbc;
+    m->tab = allocMatrixTab(m->memory_size);
+    fillDefaultMatrix(m, m->tab, m->memory_size);
     return m;
 }
 
@@ -87,21 +134,8 @@ void deleteMatrix(ptrMatrix *m) {
     testArgNull(*m, "matrix.c", "deleteMatrix", "*m");
 #endif
 
-    /* parcours de la liste générique */
-    List *l;
-    GenListIte *ite = createGenListIte((*m)->tab, FROM_BEGIN);
-    while (genListIteHasNext(ite)) {
-        genListIteNext(ite);
-        /* suppression de la ligne */
-        l = (List *)genListIteGetValue(ite);
-        deleteList(&l);
-    }
-    deleteGenListIte(&ite);
-
-    /* suppression liste générique */
-    deleteGenList(&((*m)->tab));
-
-    /* supression matrice */
+    /* suppression du tableau puis de la matrice */
+    free((*m)->tab);
     free(*m);
     *m = NULL;
 }
@@ -119,7 +153,7 @@ void matrixSet(Matrix *m, unsigned int l, unsigned int c, int v) {
               "position invalide (%d,%d) dans matrice (%d,%d)", l, c, m->nbl, m->nbc);
 #endif
 
-    listSet(genListGet(m->tab, l), v, c);
+    m->tab[(size_t)l * m->nbc + c] = v;
 }
 
 
@@ -135,7 +169,7 @@ int matrixGet(Matrix *m, unsigned int l, unsigned int c) {
               "position invalide (%d,%d) dans matrice (%d,%d)", l, c, m->nbl, m->nbc);
 #endif
 
-    return listGet(genListGet(m->tab, l), c);
+    return m->tab[(size_t)l * m->nbc + c];
 }
 
 /**
@@ -164,6 +198,18 @@ unsigned int matrixNbColonnes(Matrix *m) {
 }
 
 
+/**
+ * @date  16/10/2026
+ */
+int *matrixData(Matrix *m) {
+#ifdef DEBUG
+    testArgNull(m, "matrix.c", "matrixData", "m");
+#endif
+
+    return m->tab;
+}
+
+
 /**
  * @date  1/11/2023
  * @author Ugo VALLAT
@@ -175,15 +221,14 @@ void matrixInsertLine(Matrix *m, unsigned int l) {
         exitl("matrix.c", "matrixInsertLine", EXIT_FAILURE, "position %d invalide", l);
 #endif
 
-    /* création nouvelle ligne */
-    List *line = createList(m->nbc);
-
-    /* remplissage de la ligne avec default_value */
-    for (unsigned int i = 0; i < m->nbc; i++)
-        listAdd(line, m->default_value);
+    reserveMatrix(m, (size_t)(m->nbl + 1) * m->nbc);
 
-    /* ajout de la ligne dans la matrice */
-    genListInsert(m->tab, line, l);
+    /* décalage des lignes suivantes puis remplissage avec default_value */
+    int *line = m->tab + (size_t)l * m->nbc;
+    if (m->nbc != 0) {
+        memmove(line + m->nbc, line, (size_t)(m->nbl - l) * m->nbc * sizeof(int));
+        fillDefaultMatrix(m, line, m->nbc);
+    }
     m->nbl++;
 }
 
@@ -198,9 +243,10 @@ void matrixRemoveLine(Matrix *m, unsigned int l) {
         exitl("matrix.c", "matrixRemoveLine", EXIT_FAILURE, "position %d invalide", l);
 #endif
 
-    List *line = (List *)genListGet(m->tab, l);
-    deleteList(&line);
-    genListRemove(m->tab, l);
+    /* décalage des lignes suivantes (la mémoire n'est pas réduite) */
+    int *line = m->tab + (size_t)l * m->nbc;
+    if (m->nbc != 0)
+        memmove(line, line + m->nbc, (size_t)(m->nbl - l - 1) * m->nbc * sizeof(int));
     m->nbl--;
 }
 
@@ -215,15 +261,33 @@ void matrixInsertColumn(Matrix *m, unsigned int c) {
         exitl("matrix.c", "matrixInsertColumn", EXIT_FAILURE, "position %d invalide", c);
 #endif
 
-    /* ajout valeur par default à toutes les lignes */
-    List *line;
-    GenListIte *ite = createGenListIte(m->tab, FROM_BEGIN);
-    while (genListIteHasNext(ite)) {
-        genListIteNext(ite);
-        line = genListIteGetValue(ite);
-        listInsert(line, m->default_value, c);
+    unsigned nbc = m->nbc;
+    size_t needed = (size_t)m->nbl * (nbc + 1);
+
+    if (needed > m->memory_size) {
+        /* nouveau tableau : recopie des lignes en laissant la place de la colonne */
+        size_t new_size = 2 * m->memory_size;
+        if (new_size < needed)
+            new_size = needed;
+        int *tab = allocMatrixTab(new_size);
+        for (size_t l = 0; l < m->nbl; l++) {
+            memcpy(tab + l * (nbc + 1), m->tab + l * nbc, c * sizeof(int));
+            tab[l * (nbc + 1) + c] = m->default_value;
+            memcpy(tab + l * (nbc + 1) + c + 1, m->tab + l * nbc + c, (nbc - c) * sizeof(int));
+        }
+        free(m->tab);
+        m->tab = tab;
+        m->memory_size = new_size;
+    } else {
+        /* décalage sur place en partant de la dernière ligne */
+        for (size_t l = m->nbl; l-- > 0;) {
+            int *src = m->tab + l * nbc;
+            int *dst = m->tab + l * (nbc + 1);
+            memmove(dst + c + 1, src + c, (nbc - c) * sizeof(int));
+            memmove(dst, src, c * sizeof(int));
+            dst[c] = m->default_value;
+        }
     }
-    deleteGenListIte(&ite);
     m->nbc++;
 }
 
@@ -238,15 +302,14 @@ void matrixRemoveColumn(Matrix *m, unsigned int c) {
         exitl("matrix.c", "matrixRemoveColumn", EXIT_FAILURE, "position %d invalide", c);
 #endif
 
-    /* suppression élément dans chaque ligne */
-    List *line;
-    GenListIte *ite = createGenListIte(m->tab, FROM_BEGIN);
-    while (genListIteHasNext(ite)) {
-        genListIteNext(ite);
-        line = genListIteGetValue(ite);
-        listRemove(line, c);
+    /* compactage sur place en partant de la première ligne */
+    unsigned nbc = m->nbc;
+    for (size_t l = 0; l < m->nbl; l++) {
+        int *src = m->tab + l * nbc;
+        int *dst = m->tab + l * (nbc - 1);
+        memmove(dst, src, c * sizeof(int));
+        memmove(dst + c, src + c + 1, (nbc - c - 1) * sizeof(int));
     }
-    deleteGenListIte(&ite);
     m->nbc--;
 }
 
@@ -528,22 +591,6 @@ GenList *matrixMin(Matrix *m, int l, int c) {
 
 
 
-/**
- * @date  1/11/2023
- * @author Ugo VALLAT
- * @brief Ajoute l'élément courant à la nouvelle matrice
- * @param[in] v Valeur courante
- * @param[in] l Ligne courante
- * @param[in] c Colonne courante
- * @param[in] buff Pointeur vers la nouvelle matrice
- * @return élément courant
- */
-int fun_copy(int v, unsigned int l, unsigned int c, void *buff) {
-    Matrix *m = (Matrix *)buff;
-    matrixSet(m, l, c, v);
-    return v;
-}
-
 /**
  * @date  1/11/2023
  * @author Ugo VALLAT
@@ -553,14 +600,10 @@ Matrix *matrixCopy(Matrix *m) {
     testArgNull(m, "matrix.c", "matrixCopy", "m");
 #endif
 
-    /* Création nouvelle matrice */
+    /* Création nouvelle matrice puis copie du tableau */
     Matrix *new = createMatrix(m->nbl, m->nbc, m->default_value);
-
-    /* parcours de la matrice */
-    MatrixIte *ite = createMatrixIte(m, -1, -1, fun_copy, new);
-    while (matrixIteHasNext(ite))
-        matrixIteNext(ite);
-    deleteMatrixIte(&ite);
+    if (new->tab != NULL)
+        memcpy(new->tab, m->tab, (size_t)m->nbl * m->nbc * sizeof(int));
 
     return new;
 }
@@ -102,6 +102,18 @@ unsigned int matrixNbLines(Matrix *m);
  */
 unsigned int matrixNbColonnes(Matrix *m);
 
+/**
+ * @date  16/10/2026
+ * @brief Renvoie le tableau contigu des valeurs de la matrice (ligne par ligne)
+ *
+ * @param[in] m Pointeur vers la matrice
+ * @pre m != NULL
+ *
+ * @return tableau de nb_lignes * nb_colonnes entiers, la case (l,c) est à l'indice l * nb_colonnes + c
+ * @warning le tableau n'est plus valide après une modification des dimensions de la matrice
+ */
+int *matrixData(Matrix *m);
+
 /**
  * @date  5/11/2023
  * @brief Ajouter une ligne à la position l
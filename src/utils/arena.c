@@ -0,0 +1,195 @@
+/**
+ * @file arena.c
+ * @brief Allocateur par région (arène) pour les objets temporaires d'un scrutin
+ */
+
+#include "arena.h"
+#include <stdlib.h>
+#include <string.h>
+#include "../logger.h"
+#include "../structure/data_struct_utils.h"
+
+
+/**
+ * @date 16/10/2026
+ * @brief Bloc mémoire d'une arène, les données suivent l'en-tête
+ */
+typedef struct s_arena_block {
+    struct s_arena_block *next; /* bloc suivant (plus ancien) */
+    size_t size;                /* taille de la zone de données */
+    size_t used;                /* octets déjà distribués */
+} ArenaBlock;
+
+/* taille de l'en-tête d'un bloc, arrondie à l'alignement */
+#define HEADER_SIZE ((sizeof(ArenaBlock) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+/* début de la zone de données d'un bloc */
+#define BLOCK_DATA(b) ((unsigned char*)(b) + HEADER_SIZE)
+
+
+/**
+ * @date 16/10/2026
+ * @brief Définition de la structure arène
+ */
+struct s_arena {
+    size_t block_size;  /* taille des blocs courants */
+    size_t used;        /* octets distribués depuis la dernière remise à zéro */
+    ArenaBlock *head;   /* bloc courant, chaîné vers les plus anciens */
+    ArenaBlock *first;  /* premier bloc créé, conservé par arenaReset */
+};
+
+
+/**
+ * @date 16/10/2026
+ * @brief Alloue un bloc dont la zone de données fait size octets
+ */
+ArenaBlock *createArenaBlock(size_t size) {
+    ArenaBlock *b = malloc(HEADER_SIZE + size);
+    if (b == NULL)
+        exitl("arena.c", "createArenaBlock", EXIT_FAILURE, "erreur malloc bloc (%zu octets)", size);
+    b->next = NULL;
+    b->size = size;
+    b->used = 0;
+    return b;
+}
+
+/**
+ * @date 16/10/2026
+ */
+Arena *createArena(size_t block_size) {
+    Arena *a = malloc(sizeof(Arena));
+    if (a == NULL)
+        exitl("arena.c", "createArena", EXIT_FAILURE, "erreur malloc arène");
+
+    a->block_size = block_size > 0 ? block_size : ARENA_DEFAULT_BLOCK;
+    a->used = 0;
+    a->head = createArenaBlock(a->block_size);
+    a->first = a->head;
+    return a;
+}
+
+/**
+ * @date 16/10/2026
+ */
+void deleteArena(ptrArena *a) {
+#ifdef DEBUG
+    testArgNull(a, "arena.c", "deleteArena", "a");
+    testArgNull(*a, "arena.c", "deleteArena", "*a");
+#endif
+
+    ArenaBlock *next;
+    for (ArenaBlock *b = (*a)->head; b != NULL; b = next) {
+        next = b->next;
+        free(b);
+    }
+    free(*a);
+    *a = NULL;
+}
+
+/**
+ * @date 16/10/2026
+ */
+void *arenaAlloc(Arena *a, size_t size) {
+#ifdef DEBUG
+    testArgNull(a, "arena.c", "arenaAlloc", "a");
+#endif
+
+    ArenaBlock *b = a->head;
+    void *p;
+
+    size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    if (size == 0) size = ARENA_ALIGN;
+    a->used += size;
+
+    /* la place restante dans le bloc courant suffit */
+    if (b->size - b->used >= size) {
+        p = BLOCK_DATA(b) + b->used;
+        b->used += size;
+        return p;
+    }
+
+    /* grande demande : bloc dédié placé derrière le bloc courant, qui reste utilisable */
+    if (size > a->block_size / 4) {
+        ArenaBlock *big = createArenaBlock(size);
+        big->used = size;
+        big->next = b->next;
+        b->next = big;
+        return BLOCK_DATA(big);
+    }
+
+    /* nouveau bloc courant */
+    ArenaBlock *nb = createArenaBlock(a->block_size);
+    nb->next = b;
+    nb->used = size;
+    a->head = nb;
+    return BLOCK_DATA(nb);
+}
+
+/**
+ * @date 16/10/2026
+ */
+void arenaReset(Arena *a) {
+#ifdef DEBUG
+    testArgNull(a, "arena.c", "arenaReset", "a");
+#endif
+
+    /* seul le premier bloc créé (taille block_size) est conservé */
+    ArenaBlock *next;
+    for (ArenaBlock *b = a->head; b != NULL; b = next) {
+        next = b->next;
+        if (b != a->first) free(b);
+    }
+    a->first->next = NULL;
+    a->first->used = 0;
+    a->head = a->first;
+    a->used = 0;
+}
+
+/**
+ * @date 16/10/2026
+ */
+size_t arenaUsed(Arena *a) {
+#ifdef DEBUG
+    testArgNull(a, "arena.c", "arenaUsed", "a");
+#endif
+
+    return a->used;
+}
+
+/**
+ * @date 16/10/2026
+ */
+void *memAlloc(Arena *a, size_t size) {
+    if (a != NULL)
+        return arenaAlloc(a, size);
+
+    void *p = malloc(size > 0 ? size : 1);
+    if (p == NULL)
+        exitl("arena.c", "memAlloc", EXIT_FAILURE, "erreur malloc (%zu octets)", size);
+    return p;
+}
+
+/**
+ * @date 16/10/2026
+ */
+void *memCalloc(Arena *a, size_t nb, size_t size) {
+    void *p;
+    if (a != NULL) {
+        p = arenaAlloc(a, nb * size);
+        memset(p, 0, nb * size);
+        return p;
+    }
+
+    p = calloc(nb > 0 ? nb : 1, size > 0 ? size : 1);
+    if (p == NULL)
+        exitl("arena.c", "memCalloc", EXIT_FAILURE, "erreur calloc (%zu x %zu octets)", nb, size);
+    return p;
+}
+
+/**
+ * @date 16/10/2026
+ */
+void memFree(Arena *a, void *p) {
+    if (a == NULL)
+        free(p);
+}
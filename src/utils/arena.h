@@ -0,0 +1,123 @@
+/**
+ * @file arena.h
+ * @brief Allocateur par région (arène) pour les objets temporaires d'un scrutin
+ *
+ * Une arène distribue la mémoire par simple avancement d'un pointeur dans de grands
+ * blocs. Les objets ne sont jamais libérés un par un : toute la mémoire de l'arène est
+ * rendue d'un coup par @ref arenaReset (réutilisation) ou @ref deleteArena.
+ *
+ * Les modules acceptent une arène optionnelle : les fonctions @ref memAlloc,
+ * @ref memCalloc et @ref memFree utilisent l'arène si elle est donnée et
+ * malloc / free sinon, un même code sert ainsi dans les deux cas.
+ *
+ * @warning Une arène n'est pas protégée contre les accès concurrents
+ *
+ * @remark En cas d'erreur, toutes les fonctions exit le progamme avec un
+ * message d'erreur
+ */
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+#include <stddef.h>
+
+/* taille par défaut des blocs d'une arène (en octets) */
+#define ARENA_DEFAULT_BLOCK (64 * 1024)
+
+/* alignement des allocations (en octets) */
+#define ARENA_ALIGN 16
+
+/* Définition opaque de la structure arène */
+typedef struct s_arena Arena;
+typedef Arena *ptrArena;
+
+/**
+ * @date 16/10/2026
+ * @brief Crée une arène vide
+ *
+ * @param[in] block_size taille des blocs alloués (0 pour @ref ARENA_DEFAULT_BLOCK)
+ *
+ * @return pointeur vers l'arène
+ */
+Arena *createArena(size_t block_size);
+
+/**
+ * @date 16/10/2026
+ * @brief Supprime l'arène et toute la mémoire distribuée
+ *
+ * @param[in] a arène à supprimer
+ * @pre a != NULL
+ * @pre *a != NULL
+ */
+void deleteArena(ptrArena *a);
+
+/**
+ * @date 16/10/2026
+ * @brief Alloue size octets dans l'arène (alignés sur @ref ARENA_ALIGN)
+ *
+ * @param[in] a arène
+ * @param[in] size nombre d'octets
+ * @pre a != NULL
+ *
+ * @return pointeur vers la zone allouée (non initialisée)
+ * @note une demande plus grande qu'un bloc reçoit son propre bloc
+ */
+void *arenaAlloc(Arena *a, size_t size);
+
+/**
+ * @date 16/10/2026
+ * @brief Rend toute la mémoire distribuée par l'arène, le premier bloc est conservé
+ * pour les allocations suivantes
+ *
+ * @param[in] a arène
+ * @pre a != NULL
+ * @post tous les pointeurs obtenus de l'arène sont invalides
+ */
+void arenaReset(Arena *a);
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie le nombre d'octets distribués par l'arène depuis sa création ou
+ * sa dernière remise à zéro
+ *
+ * @param[in] a arène
+ * @pre a != NULL
+ *
+ * @return nombre d'octets utilisés (alignement compris)
+ */
+size_t arenaUsed(Arena *a);
+
+/**
+ * @date 16/10/2026
+ * @brief Alloue size octets dans l'arène si elle est donnée, avec malloc sinon
+ *
+ * @param[in] a arène (peut être NULL)
+ * @param[in] size nombre d'octets
+ *
+ * @return pointeur vers la zone allouée (non initialisée)
+ */
+void *memAlloc(Arena *a, size_t size);
+
+/**
+ * @date 16/10/2026
+ * @brief Alloue nb * size octets initialisés à 0 dans l'arène si elle est donnée, avec
+ * calloc sinon
+ *
+ * @param[in] a arène (peut être NULL)
+ * @param[in] nb nombre d'éléments
+ * @param[in] size taille d'un élément
+ *
+ * @return pointeur vers la zone allouée
+ */
+void *memCalloc(Arena *a, size_t nb, size_t size);
+
+/**
+ * @date 16/10/2026
+ * @brief Libère une zone obtenue par @ref memAlloc ou @ref memCalloc : free sans arène,
+ * rien avec arène (libérée avec l'arène)
+ *
+ * @param[in] a arène utilisée pour l'allocation (peut être NULL)
+ * @param[in] p zone à libérer
+ */
+void memFree(Arena *a, void *p);
+
+#endif
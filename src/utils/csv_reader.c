@@ -2,22 +2,71 @@
  * @author Ugo VALLAT, Corentin LUDWIG
  * @brief Chargement du csv
  * @date 2023-11-26
- * 
+ *
+ * Le fichier est projeté en mémoire (mmap) et analysé directement depuis les pages
+ * projetées : aucune ligne n'est recopiée et la longueur des lignes n'est pas limitée.
  */
 
+#define _POSIX_C_SOURCE 200112L
 
 #include "csv_reader.h"
+#include <fcntl.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <string.h> 
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "../structure/bale.h"
 #include "../structure/duel.h"
 #include "../structure/genericlist.h"
+#include "../structure/list.h"
+#include <stdint.h>
 #include "../logger.h"
+#include "parallel.h"
 
 #define USLESS_COLUMN_BALE 4
-#define USLESS_CHAR 14
-#define SIZE_BUFF_LINE 512
+
+/* taille minimale (octets) de la part du fichier lue par chaque thread */
+#define CSV_MIN_CHUNK_SIZE (1 << 20)
+
+
+/**
+ * @date 16/10/2026
+ * @brief Fichier csv projeté en mémoire
+ */
+typedef struct s_csv_file {
+    const char *data;   /* début du fichier projeté */
+    const char *end;    /* fin du fichier (premier octet hors fichier) */
+    size_t size;        /* taille du fichier en octets */
+} CsvFile;
+
+
+/**
+ * @date 16/10/2026
+ * @brief Part du fichier lue par un thread
+ */
+typedef struct s_csv_chunk {
+    const char *begin;  /* début de la part (début d'une ligne) */
+    const char *end;    /* fin de la part (début de la part suivante) */
+    unsigned first_line;/* indice dans le ballot de la première ligne de la part */
+    unsigned nb_line;   /* nombre de lignes de données de la part */
+    List *wide;         /* cases (ligne, colonne, valeur) trop larges pour le ballot */
+} CsvChunk;
+
+
+/**
+ * @date 16/10/2026
+ * @brief Contexte de lecture parallèle d'un ballot
+ */
+typedef struct s_csv_parallel {
+    CsvChunk *chunks;   /* parts du fichier, une par thread */
+    unsigned nbc;       /* nombre de candidats */
+    Bale *bale;         /* ballot à remplir */
+    fun_ballot fun;     /* fonction appelée pour chaque votant (lecture sans ballot) */
+    void **states;      /* état de chaque thread passé à fun */
+} CsvParallel;
 
 
 /**
@@ -26,7 +75,7 @@
  * @brief Supprime et libere la memoire de la genList et de tout les pointeur quel contients
  *
  * @param[in] la list a supprimer
- * 
+ *
  * @return <explications>
 */
 void freeListLabel(GenList *list){
@@ -36,79 +85,242 @@ void freeListLabel(GenList *list){
 }
 
 
+/**
+ * @date 16/10/2026
+ * @brief Projette le fichier en mémoire en lecture seule
+ *
+ * @param[in] file nom/path du fichier
+ * @param[in] fun nom de la fonction appelante (message d'erreur)
+ *
+ * @return le fichier projeté
+ */
+CsvFile openCsv(char *file, char *fun) {
+    CsvFile csv;
+    struct stat info;
+
+    int fd = open(file, O_RDONLY);
+    if(fd == -1)
+        exitl("csv_reader.c", fun, EXIT_FAILURE, "Echec ouverture fichier");
+    if(fstat(fd, &info) == -1 || info.st_size == 0) {
+        close(fd);
+        exitl("csv_reader.c", fun, EXIT_FAILURE, "Fichier vide ou illisible");
+    }
+
+    csv.size = (size_t)info.st_size;
+    void *data = mmap(NULL, csv.size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(data == MAP_FAILED)
+        exitl("csv_reader.c", fun, EXIT_FAILURE, "Echec projection fichier");
+
+    /* lecture séquentielle : le noyau peut lire en avance et libérer derrière */
+    posix_madvise(data, csv.size, POSIX_MADV_SEQUENTIAL);
+
+    csv.data = data;
+    csv.end = csv.data + csv.size;
+    return csv;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Libère la projection du fichier
+ *
+ * @param[in] csv fichier projeté
+ */
+void closeCsv(CsvFile *csv) {
+    munmap((void*)csv->data, csv->size);
+    csv->data = csv->end = NULL;
+    csv->size = 0;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie la fin de la ligne commençant en cur (position du '\n' ou fin du fichier)
+ */
+const char *endOfLine(const char *cur, const char *end) {
+    const char *eol = memchr(cur, '\n', end - cur);
+    return eol == NULL ? end : eol;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie le début de la ligne suivant celle terminée en eol
+ */
+const char *startOfNextLine(const char *eol, const char *end) {
+    return eol < end ? eol + 1 : end;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie si la ligne [cur, eol[ ne contient que des espaces
+ */
+bool isBlankLine(const char *cur, const char *eol) {
+    for(; cur < eol; cur++)
+        if(*cur != ' ' && *cur != '\t' && *cur != '\r')
+            return false;
+    return true;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie le début de la prochaine ligne non vide à partir de cur
+ *
+ * @return début de la ligne, end si il n'y en a plus
+ */
+const char *nextDataLine(const char *cur, const char *end) {
+    const char *eol;
+    while(cur < end) {
+        eol = endOfLine(cur, end);
+        if(!isBlankLine(cur, eol))
+            return cur;
+        cur = startOfNextLine(eol, end);
+    }
+    return end;
+}
+
+
 /**
  * @date 23/11/2023
  * @author LUDWIG Corentin
- * @brief compte le nombre de ligne du fihier passer en parametre
+ * @brief compte le nombre de ligne non vide entre cur et end
+ *
+ * @param[in] cur début de la zone
+ * @param[in] end fin de la zone
  *
- * @param[in] nom/path du fichier
- * 
- * @return nombre de ligne du fichier
+ * @return nombre de ligne
 */
-int nbLigne(FILE *file){
-    int nb_line = 0;
-    char buff[SIZE_BUFF_LINE];
-    rewind(file);
-    while(fgets(buff, SIZE_BUFF_LINE, file)) {
-        if(strlen(buff) > 10) nb_line++;
+unsigned nbLigne(const char *cur, const char *end){
+    unsigned nb_line = 0;
+    for(cur = nextDataLine(cur, end); cur < end; cur = nextDataLine(cur, end)) {
+        nb_line++;
+        cur = startOfNextLine(endOfLine(cur, end), end);
     }
-    rewind(file);
     return nb_line;
 }
 
 
+/**
+ * @date 16/10/2026
+ * @brief Passe le champ courant de la ligne
+ *
+ * @return début du champ suivant, eol si c'était le dernier
+ */
+const char *skipField(const char *cur, const char *eol) {
+    const char *comma = memchr(cur, ',', eol - cur);
+    return comma == NULL ? eol : comma + 1;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Lit l'entier du champ courant et avance au champ suivant
+ *
+ * @param[in,out] cur position dans la ligne, placée au début du champ suivant
+ * @param[in] eol fin de la ligne
+ *
+ * @return valeur lue, -1 si le champ ne contient pas d'entier (candidat non classé)
+ */
+int parseField(const char **cur, const char *eol) {
+    const char *c = *cur;
+    bool negative = false;
+    int value = 0;
+
+    while(c < eol && *c == ' ') c++;
+    if(c < eol && (*c == '-' || *c == '+')) {
+        negative = *c == '-';
+        c++;
+    }
+    if(c == eol || *c < '0' || *c > '9')
+        value = -1;
+    else {
+        for(; c < eol && *c >= '0' && *c <= '9'; c++)
+            value = value * 10 + (*c - '0');
+        if(negative) value = -value;
+    }
+
+    *cur = skipField(c, eol);
+    return value;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Lit les entiers d'une ligne de données
+ *
+ * @param[in] cur début de la ligne
+ * @param[in] eol fin de la ligne
+ * @param[in] skipped_column nombre de colonnes à ignorer en début de ligne
+ * @param[out] values tableau des valeurs lues (taille >= nb_values)
+ * @param[in] nb_values nombre maximum de valeurs à lire
+ *
+ * @return nombre de valeurs lues
+ */
+unsigned parseLine(const char *cur, const char *eol, unsigned skipped_column, int *values, unsigned nb_values) {
+    for(unsigned i = 0; i < skipped_column && cur < eol; i++)
+        cur = skipField(cur, eol);
+
+    unsigned nb = 0;
+    while(nb < nb_values && cur < eol && !isBlankLine(cur, eol))
+        values[nb++] = parseField(&cur, eol);
+    return nb;
+}
+
+
 /**
  * @date 26/11/2023
  * @author Ugo VALLAT, Corentin LUDWIG
- * @brief Format les labels
- * 
- * @param[in] token Token d'entrée du csv
+ * @brief Format les labels (espaces de début et fin de ligne retirés)
+ *
+ * @param[in] token début du champ du csv
+ * @param[in] end fin du champ
  * @param[out] label Pointeur vers le label à remplir
  */
-void tokenToLabel(char* token, char* label) {
-    int i = 0;
-    int size_tok = strlen(token);
-    if (size_tok > MAX_LENGHT_LABEL)  
-        size_tok = MAX_LENGHT_LABEL;
-    while(token[i] == ' ') {
-        size_tok--;
+void tokenToLabel(const char* token, const char *end, char* label) {
+    while(token < end && *token == ' ')
         token++;
-    }
-    while(i<size_tok && token[i] != '\n') i++;
-        token[i] = '\0';
-    strncpy(label,token, MAX_LENGHT_LABEL);
+    while(end > token && (end[-1] == '\r' || end[-1] == '\n'))
+        end--;
+    size_t size_tok = end - token;
+    if (size_tok >= MAX_LENGHT_LABEL)
+        size_tok = MAX_LENGHT_LABEL - 1;
+    memcpy(label, token, size_tok);
+    label[size_tok] = '\0';
 }
 
 
 /**
  * @date 23/11/2023
  * @author LUDWIG Corentin
- * @brief remplit la liste label avec les noms des candidat present de le fichier file
+ * @brief remplit la liste label avec les noms des candidat present sur la première ligne du fichier
  *
- * @param[in] nom/path du fichier
+ * @param[in] csv fichier projeté
  * @param[out] list des labels remplit apres l'execution de la fonction
+ * @param[in] skipped_column nombre de colonnes à ignorer
  *
- * @pre len(label) >= nb lable dans le fichier
+ * @return début de la ligne suivant l'en-tête
 */
-void readLabel(FILE *file,GenList *label, unsigned skipped_column){
-    char buffer[SIZE_BUFF_LINE];
-    char* token;
+const char *readLabel(CsvFile *csv, GenList *label, unsigned skipped_column){
+    const char *cur = nextDataLine(csv->data, csv->end);
+    const char *eol = endOfLine(cur, csv->end);
+    const char *next;
     char* label_name;
-    fgets(buffer, sizeof(buffer), file);
 
-    token = strtok(buffer,",");
+    for(unsigned int i = 0; i<skipped_column && cur < eol; i++) //passe les colonnes inutiles
+        cur = skipField(cur, eol);
 
-    for(unsigned int i = 0; i<skipped_column; i++){ //passe les lignes inutiles
-        token = strtok(NULL,",");
-    }
-    
-   for (int i = 0; token; i++)
-   {
+    while(cur < eol) {
+        next = skipField(cur, eol);
         label_name = malloc(MAX_LENGHT_LABEL);
-        tokenToLabel(token, label_name);
-        genListInsert(label,(void*)label_name,i);
-        token = strtok(NULL,",");
-   }
+        tokenToLabel(cur, next == eol ? eol : next - 1, label_name);
+        genListAdd(label, (void*)label_name);
+        cur = next;
+    }
+
+    return startOfNextLine(eol, csv->end);
 }
 
 
@@ -117,39 +329,162 @@ void readLabel(FILE *file,GenList *label, unsigned skipped_column){
  * @author LUDWIG Corentin
  * @brief remplit le ballot passer en parametre avec les information contenu dans le fichier passer en entree
  *
+ * @param[in] cur début de la première ligne de données
+ * @param[in] end fin de la zone à lire
  * @param[out] bale ballot a remplir
- * @param[in] file fichier dans le quelle lire
- * 
- * @pre baleNBcandidat(bale) >= NB_CADIDATES && baleNbVotant(bale) >= nbLigne(file)
+ * @param[in] first_line indice dans le ballot de la première ligne lue
+ * @param[in] nbl nombre de lignes à lire
+ * @param[out] wide triplets (ligne, colonne, valeur) des valeurs qui ne tiennent pas dans les
+ * cases du ballot, non écrites : leur écriture élargit le ballot, elle est faite après les
+ * remplissages parallèles
+ *
+ * @pre baleNbLine(bale) >= first_line + nbl
 */
-void fillBale(FILE *file, Bale *bale, int nbl) {
-    char buffer[SIZE_BUFF_LINE];
-    char* token;
-    int n;
-
-    /* ignorer première ligne */
-    strncpy(buffer, "", SIZE_BUFF_LINE);
-    fgets(buffer, sizeof(buffer), file);
-
-    for(int l = 0; l < nbl; l++) {
-        /* lecture ligne */
-        if(!fgets(buffer, sizeof(buffer), file))
+void fillBale(const char *cur, const char *end, Bale *bale, unsigned first_line, unsigned nbl, List *wide) {
+    const char *eol;
+    unsigned nbc = baleNbCandidat(bale);
+    unsigned nb_values;
+    int values[nbc > 0 ? nbc : 1];
+    unsigned cell_size = baleCellSize(bale);
+    int max = cell_size == sizeof(int8_t) ? INT8_MAX : cell_size == sizeof(int16_t) ? INT16_MAX : INT32_MAX;
+
+    for(unsigned l = first_line; l < first_line + nbl; l++) {
+        cur = nextDataLine(cur, end);
+        if(cur == end)
             exitl("csv_reader.c", "fillBale", EXIT_FAILURE, "Echec lecture ligne");
-        
-        /* convertion en token */
-        token = strtok(buffer,",");
-
-        for(int i = 0; i<USLESS_COLUMN_BALE;i++){ //passe les colonnes inutiles
-            token = strtok(NULL,",");
+        eol = endOfLine(cur, end);
+
+        nb_values = parseLine(cur, eol, USLESS_COLUMN_BALE, values, nbc);
+        for(unsigned c = 0; c < nb_values; c++) {
+            if(values[c] > max || values[c] < -max - 1) {
+                listAdd(wide, l);
+                listAdd(wide, c);
+                listAdd(wide, values[c]);
+            } else
+                baleSetValue(bale, l, c, values[c]);
         }
 
-        /* récupération des tokens */
-        for (unsigned c = 0; token; c++) {
-            sscanf(token,"%d",&n);
-            bale = baleSetValue(bale, l, c, n);
-            token = strtok(NULL,",");
-        }
+        cur = startOfNextLine(eol, end);
+    }
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Découpe la zone [data, end[ en nb_chunks parts de tailles proches
+ * commençant chacune en début de ligne
+ *
+ * @param[in] data début des données
+ * @param[in] end fin des données
+ * @param[out] chunks tableau des parts (taille >= nb_chunks)
+ * @param[in] nb_chunks nombre de parts
+ *
+ * @note une part peut être vide si une ligne est plus longue que la part
+ */
+void splitChunks(const char *data, const char *end, CsvChunk *chunks, unsigned nb_chunks) {
+    size_t size = end - data;
+    const char *cut;
+
+    chunks[0].begin = data;
+    for(unsigned i = 1; i < nb_chunks; i++) {
+        cut = data + size / nb_chunks * i;
+        if(cut < chunks[i-1].begin)
+            cut = chunks[i-1].begin;
+        else if(cut > data && cut[-1] != '\n')
+            cut = endOfLine(cut, end);
+        if(cut < end && *cut == '\n')
+            cut++;
+        chunks[i].begin = chunks[i-1].end = cut;
+    }
+    chunks[nb_chunks - 1].end = end;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Compte les lignes de la part du thread id (fonction de thread)
+ */
+void countChunkThread(unsigned id, unsigned nb_threads, void *arg) {
+    (void)nb_threads;
+    CsvChunk *chunk = &((CsvParallel*)arg)->chunks[id];
+    chunk->nb_line = nbLigne(chunk->begin, chunk->end);
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Lit les lignes de la part du thread id dans le ballot (fonction de thread)
+ */
+void fillChunkThread(unsigned id, unsigned nb_threads, void *arg) {
+    (void)nb_threads;
+    CsvParallel *csv_parallel = (CsvParallel*)arg;
+    CsvChunk *chunk = &csv_parallel->chunks[id];
+    fillBale(chunk->begin, chunk->end, csv_parallel->bale, chunk->first_line, chunk->nb_line, chunk->wide);
+}
+
+
+/**
+ * @date 16/10/2026
+ */
+unsigned csvNbThreads(char *file, char *fun) {
+    struct stat info;
+    if(stat(file, &info) == -1)
+        exitl("csv_reader.c", fun, EXIT_FAILURE, "Echec ouverture fichier");
+
+    size_t nb_chunks = (size_t)info.st_size / CSV_MIN_CHUNK_SIZE;
+    unsigned nb_threads = parallelNbThreads();
+    if(nb_chunks < nb_threads)
+        nb_threads = nb_chunks < 1 ? 1 : (unsigned)nb_chunks;
+    return nb_threads;
+}
+
+
+/**
+ * @date 16/10/2026
+*/
+Bale* csvToBaleParallel(char *file, unsigned nb_threads) {
+    if(nb_threads < 1 || nb_threads > PARALLEL_MAX_THREADS)
+        exitl("csv_reader.c", "csvToBaleParallel", EXIT_FAILURE, "nombre de threads invalide (%u)", nb_threads);
+
+    /* projection du csv */
+    CsvFile csv = openCsv(file, "csvToBaleParallel");
+
+    /* récupération des labels */
+    GenList *label = createGenList(10);
+    const char *data = readLabel(&csv, label, USLESS_COLUMN_BALE);
+    unsigned nbc = genListSize(label);
+
+    /* découpage du fichier et comptage des lignes de chaque part */
+    CsvParallel csv_parallel;
+    csv_parallel.chunks = malloc(nb_threads * sizeof(CsvChunk));
+    splitChunks(data, csv.end, csv_parallel.chunks, nb_threads);
+    parallelRun(countChunkThread, nb_threads, &csv_parallel);
+
+    /* position des parts dans le ballot (ordre des votants) */
+    unsigned nbl = 0;
+    for(unsigned i = 0; i < nb_threads; i++) {
+        csv_parallel.chunks[i].first_line = nbl;
+        csv_parallel.chunks[i].wide = createList(0);
+        nbl += csv_parallel.chunks[i].nb_line;
+    }
+
+    /* création et remplissage du ballot */
+    csv_parallel.bale = createBale(nbl, nbc, label);
+    parallelRun(fillChunkThread, nb_threads, &csv_parallel);
+    freeListLabel(label);
+
+    /* valeurs inattendues (rang au-delà du nombre de candidats...) : élargissement du ballot */
+    List *wide;
+    for(unsigned i = 0; i < nb_threads; i++) {
+        wide = csv_parallel.chunks[i].wide;
+        for(unsigned k = 0; k + 2 < listSize(wide); k += 3)
+            baleSetValue(csv_parallel.bale, listGet(wide, k), listGet(wide, k + 1), listGet(wide, k + 2));
+        deleteList(&csv_parallel.chunks[i].wide);
     }
+
+    free(csv_parallel.chunks);
+    closeCsv(&csv);
+    return csv_parallel.bale;
 }
 
 
@@ -158,29 +493,171 @@ void fillBale(FILE *file, Bale *bale, int nbl) {
  * @author LUDWIG Corentin
 */
 Bale* csvToBale(char *file){
-    /* ouverture du csv */
-    FILE *file_pointer;
-    file_pointer = fopen(file,"r");
-    if(!file_pointer)
-        exitl("csv_reader.c", "csvToBale", EXIT_FAILURE, "Echec ouverture fichier");
+    return csvToBaleParallel(file, csvNbThreads(file, "csvToBale"));
+}
 
-    /* récupération des labels */
+
+
+
+/**
+ * @date 16/10/2026
+ * @brief Lit un par un les votants des lignes de [cur, end[ et appelle fun sur chacun
+ *
+ * @param[in] cur début de la zone à lire (début de ligne)
+ * @param[in] end fin de la zone à lire
+ * @param[in] nbc nombre de candidats
+ * @param[in] fun fonction appelée pour chaque votant
+ * @param[in,out] state état passé à fun
+ *
+ * @return nombre de votants lus
+ */
+static inline unsigned readBallots(const char *cur, const char *end, unsigned nbc, fun_ballot fun, void *state) {
+    const char *eol;
+    unsigned nb_values, nbl = 0;
+    int ballot[nbc > 0 ? nbc : 1];
+
+    for(cur = nextDataLine(cur, end); cur < end; cur = nextDataLine(startOfNextLine(eol, end), end)) {
+        eol = endOfLine(cur, end);
+        nb_values = parseLine(cur, eol, USLESS_COLUMN_BALE, ballot, nbc);
+        for(unsigned c = nb_values; c < nbc; c++)
+            ballot[c] = DEFAULT_VALUE; /* colonnes absentes : comme une case vide du ballot */
+        fun(ballot, state);
+        nbl++;
+    }
+    return nbl;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Ajoute un votant aux scores d'une matrice de duels (fonction de lecture)
+ */
+void addBallotToDuel(const int *ballot, void *duel) {
+    duelAddBallot((Duel*)duel, ballot, 1);
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Ajoute les votants de la part du thread id à sa matrice de duels (fonction de thread)
+ */
+void addBallotsThread(unsigned id, unsigned nb_threads, void *arg) {
+    (void)nb_threads;
+    CsvParallel *csv_parallel = (CsvParallel*)arg;
+    CsvChunk *chunk = &csv_parallel->chunks[id];
+    chunk->nb_line = readBallots(chunk->begin, chunk->end, csv_parallel->nbc, addBallotToDuel, csv_parallel->states[id]);
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Appelle la fonction de lecture sur les votants de la part du thread id (fonction de thread)
+ */
+void forEachBallotThread(unsigned id, unsigned nb_threads, void *arg) {
+    (void)nb_threads;
+    CsvParallel *csv_parallel = (CsvParallel*)arg;
+    CsvChunk *chunk = &csv_parallel->chunks[id];
+    chunk->nb_line = readBallots(chunk->begin, chunk->end, csv_parallel->nbc, csv_parallel->fun, csv_parallel->states[id]);
+}
+
+
+/**
+ * @date 16/10/2026
+*/
+Duel* csvBaleToDuel(char *file, unsigned *nb_voters) {
+    return csvBaleToDuelParallel(file, nb_voters, csvNbThreads(file, "csvBaleToDuel"));
+}
+
+
+/**
+ * @date 16/10/2026
+*/
+Duel* csvBaleToDuelParallel(char *file, unsigned *nb_voters, unsigned nb_threads) {
+    if(nb_threads < 1 || nb_threads > PARALLEL_MAX_THREADS)
+        exitl("csv_reader.c", "csvBaleToDuelParallel", EXIT_FAILURE, "nombre de threads invalide (%u)", nb_threads);
+
+    /* projection du csv */
+    CsvFile csv = openCsv(file, "csvBaleToDuelParallel");
+
+    /* récupération des labels, une matrice de duels par thread */
     GenList *label = createGenList(10);
-    readLabel(file_pointer, label,USLESS_COLUMN_BALE);
+    const char *data = readLabel(&csv, label, USLESS_COLUMN_BALE);
+    unsigned nbc = genListSize(label);
+    LabelTable *table = createLabelTable(label);
+    freeListLabel(label);
+    CsvParallel csv_parallel;
+    csv_parallel.nbc = nbc;
+    csv_parallel.states = malloc(nb_threads * sizeof(void*));
+    for(unsigned i = 0; i < nb_threads; i++)
+        csv_parallel.states[i] = createEmptyDuel(nbc, table);
+    deleteLabelTable(&table);
+
+    /* lecture des parts puis réduction dans la matrice du thread 0 */
+    csv_parallel.chunks = malloc(nb_threads * sizeof(CsvChunk));
+    splitChunks(data, csv.end, csv_parallel.chunks, nb_threads);
+    parallelRun(addBallotsThread, nb_threads, &csv_parallel);
+
+    Duel *duel = csv_parallel.states[0], *other;
+    unsigned nbl = csv_parallel.chunks[0].nb_line;
+    for(unsigned i = 1; i < nb_threads; i++) {
+        other = csv_parallel.states[i];
+        duelAdd(duel, other);
+        deleteDuel(&other);
+        nbl += csv_parallel.chunks[i].nb_line;
+    }
 
-    /* compte nombre de lignes/colonnes */
-    int nbl_file = nbLigne(file_pointer);
-    int nbc = genListSize(label);
+    if(nb_voters != NULL) *nb_voters = nbl;
+    free(csv_parallel.states);
+    free(csv_parallel.chunks);
+    closeCsv(&csv);
+    return duel;
+}
 
 
-    /* création ballot */
-    rewind(file_pointer);
-    Bale *bale = createBale(nbl_file-1,nbc,label);
-    fillBale(file_pointer, bale, nbl_file-1);
+/**
+ * @date 16/10/2026
+*/
+LabelTable* csvBaleLabels(char *file) {
+    CsvFile csv = openCsv(file, "csvBaleLabels");
+    GenList *label = createGenList(10);
+    readLabel(&csv, label, USLESS_COLUMN_BALE);
+    LabelTable *table = createLabelTable(label);
     freeListLabel(label);
+    closeCsv(&csv);
+    return table;
+}
+
+
+/**
+ * @date 16/10/2026
+*/
+unsigned csvForEachBallotParallel(char *file, fun_ballot fun, void **states, unsigned nb_threads) {
+    if(nb_threads < 1 || nb_threads > PARALLEL_MAX_THREADS)
+        exitl("csv_reader.c", "csvForEachBallotParallel", EXIT_FAILURE, "nombre de threads invalide (%u)", nb_threads);
 
-    fclose(file_pointer);
-    return bale;
+    /* projection du csv, l'en-tête ne sert qu'au nombre de candidats */
+    CsvFile csv = openCsv(file, "csvForEachBallotParallel");
+    GenList *label = createGenList(10);
+    const char *data = readLabel(&csv, label, USLESS_COLUMN_BALE);
+
+    CsvParallel csv_parallel;
+    csv_parallel.nbc = genListSize(label);
+    csv_parallel.fun = fun;
+    csv_parallel.states = states;
+    freeListLabel(label);
+
+    /* lecture des parts */
+    csv_parallel.chunks = malloc(nb_threads * sizeof(CsvChunk));
+    splitChunks(data, csv.end, csv_parallel.chunks, nb_threads);
+    parallelRun(forEachBallotThread, nb_threads, &csv_parallel);
+
+    unsigned nbl = 0;
+    for(unsigned i = 0; i < nb_threads; i++)
+        nbl += csv_parallel.chunks[i].nb_line;
+
+    free(csv_parallel.chunks);
+    closeCsv(&csv);
+    return nbl;
 }
 
 
@@ -189,35 +666,29 @@ Bale* csvToBale(char *file){
 /**
  * @date 23/11/2023
  * @author LUDWIG Corentin
- * @brief remplit le ballot passer en parametre avec les information contenu dans le fichier passer en entree
+ * @brief remplit la matrice de duel passée en parametre avec les information contenu dans le fichier
  *
- * @param[out] bale ballot a remplir
- * @param[in] file fichier dans le quelle lire
- * 
- * @pre baleNBcandidat(bale) >= NB_CADIDATES && baleNbVotant(bale) >= nbLigne(file)
+ * @param[in] cur début de la première ligne de données
+ * @param[in] end fin du fichier
+ * @param[out] duel matrice de duel à remplir
+ * @param[in] nb_candidats nombre de candidats (lignes à lire)
 */
-void fillDuel(FILE *file, Duel *duel, int nb_candidats) {
-    char buffer[SIZE_BUFF_LINE];
-    char* token;
-    int n;
-
-    /* ignorer première ligne */
-    strncpy(buffer, "", SIZE_BUFF_LINE);
-    fgets(buffer, sizeof(buffer), file);
-
-    for(int l = 0; l < nb_candidats; l++) {
-        /* lecture ligne */
-        if(!fgets(buffer, sizeof(buffer), file))
+void fillDuel(const char *cur, const char *end, Duel *duel, unsigned nb_candidats) {
+    const char *eol;
+    unsigned nb_values;
+    int values[nb_candidats > 0 ? nb_candidats : 1];
+
+    for(unsigned l = 0; l < nb_candidats; l++) {
+        cur = nextDataLine(cur, end);
+        if(cur == end)
             exitl("csv_reader.c", "fillDuel", EXIT_FAILURE, "Echec lecture ligne");
-        /* convertion en token */
-        token = strtok(buffer,",");
-
-        /* récupération des tokens */
-        for (unsigned c = 0; token; c++) {
-            sscanf(token,"%d",&n);
-            duel = duelSetValue(duel, l, c, n);
-            token = strtok(NULL,",");
-        }
+        eol = endOfLine(cur, end);
+
+        nb_values = parseLine(cur, eol, 0, values, nb_candidats);
+        for(unsigned c = 0; c < nb_values; c++)
+            duel = duelSetValue(duel, l, c, values[c]);
+
+        cur = startOfNextLine(eol, end);
     }
 }
 
@@ -231,23 +702,19 @@ void fillDuel(FILE *file, Duel *duel, int nb_candidats) {
  * @author Ugo VALLAT
 */
 Duel* csvToDuel(char *file){
-    /* ouverture du csv */
-    FILE *file_pointer;
-    file_pointer = fopen(file,"r");
-    if(!file_pointer)
-        exitl("csv_reader.c", "csvToDuel", EXIT_FAILURE, "Echec ouverture fichier");
+    /* projection du csv */
+    CsvFile csv = openCsv(file, "csvToDuel");
 
     /* récupération des labels */
     GenList *label = createGenList(10);
-    readLabel(file_pointer, label,0);
+    const char *data = readLabel(&csv, label, 0);
 
     /* création duel */
-    rewind(file_pointer);
     unsigned nb_candidat = genListSize(label);
     Duel *duel = createDuel(nb_candidat, label);
-    fillDuel(file_pointer,duel, nb_candidat);
+    fillDuel(data, csv.end, duel, nb_candidat);
     freeListLabel(label);
 
-    fclose(file_pointer);
+    closeCsv(&csv);
     return duel;
 }
@@ -8,6 +8,7 @@
 
 #include "../structure/duel.h"
 #include "../structure/bale.h"
+#include "parallel.h"
 
 
 /**
@@ -28,8 +29,108 @@ Duel* csvToDuel(char *file);
  * @param[in] nom_file nom/path du fichier csv
  * 
  * @return une matrice @ref Bale
+ *
+ * @note les gros fichiers sont lus en parallèle (voir @ref csvToBaleParallel) avec au plus
+ * @ref parallelNbThreads threads
 */
 Bale* csvToBale(char *file);
 
 
+/**
+ * @date 16/10/2026
+ * @brief Remplit un ballot appartir d'un fichier csv en répartissant la lecture sur plusieurs threads
+ *
+ * Le fichier est découpé en nb_threads parts alignées sur les fins de ligne, chaque
+ * thread lit sa part dans les lignes du ballot qui lui correspondent. Les votants
+ * restent dans l'ordre du fichier.
+ *
+ * @param[in] file nom/path du fichier csv
+ * @param[in] nb_threads nombre de threads
+ * @pre 1 <= nb_threads <= @ref PARALLEL_MAX_THREADS
+ *
+ * @return une matrice @ref Bale identique à celle de @ref csvToBale
+*/
+Bale* csvToBaleParallel(char *file, unsigned nb_threads);
+
+
+/**
+ * @date 16/10/2026
+ * @brief Calcule la matrice de duels d'un fichier csv de ballot sans construire le ballot
+ *
+ * Les votants sont lus un par un et leurs préférences ajoutées directement aux scores
+ * des duels : la mémoire utilisée ne dépend que du nombre de candidats (et du nombre
+ * de threads pour les gros fichiers, voir @ref csvBaleToDuelParallel).
+ *
+ * @param[in] file nom/path du fichier csv (format ballot)
+ * @param[out] nb_voters nombre de votants lus (ignoré si NULL)
+ *
+ * @return une matrice @ref Duel identique à duelFromBale(csvToBale(file))
+*/
+Duel* csvBaleToDuel(char *file, unsigned *nb_voters);
+
+
+/**
+ * @date 16/10/2026
+ * @brief Calcule la matrice de duels d'un fichier csv de ballot en répartissant la lecture
+ * sur plusieurs threads
+ *
+ * Chaque thread lit une part du fichier (alignée sur les fins de ligne) et compte ses
+ * votants dans sa propre matrice de duels, les matrices sont ensuite additionnées.
+ *
+ * @param[in] file nom/path du fichier csv (format ballot)
+ * @param[out] nb_voters nombre de votants lus (ignoré si NULL)
+ * @param[in] nb_threads nombre de threads
+ * @pre 1 <= nb_threads <= @ref PARALLEL_MAX_THREADS
+ *
+ * @return une matrice @ref Duel identique à celle de @ref csvBaleToDuel
+*/
+Duel* csvBaleToDuelParallel(char *file, unsigned *nb_voters, unsigned nb_threads);
+
+
+/**
+ * @date 16/10/2026
+ * @brief Fonction appelée pour chaque votant lu par @ref csvForEachBallotParallel
+ *
+ * @param[in] ballot votes du votant (une case par candidat, colonnes absentes à DEFAULT_VALUE)
+ * @param[in,out] state état du thread qui a lu le votant
+ */
+typedef void (*fun_ballot)(const int *ballot, void *state);
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie le nombre de threads à utiliser pour lire le fichier : un thread par Mo,
+ * dans la limite de @ref parallelNbThreads
+ *
+ * @param[in] file nom/path du fichier
+ * @param[in] fun nom de la fonction appelante (message d'erreur)
+ */
+unsigned csvNbThreads(char *file, char *fun);
+
+/**
+ * @date 16/10/2026
+ * @brief Lit les labels des candidats d'un fichier csv de ballot (en-tête seulement)
+ *
+ * @param[in] file nom/path du fichier csv (format ballot)
+ *
+ * @return table des labels, à libérer avec deleteLabelTable
+*/
+LabelTable* csvBaleLabels(char *file);
+
+/**
+ * @date 16/10/2026
+ * @brief Lit un fichier csv de ballot votant par votant sans construire le ballot
+ *
+ * Chaque thread lit une part du fichier (alignée sur les fins de ligne) et appelle fun sur
+ * chacun de ses votants avec son propre état : la mémoire utilisée ne dépend pas du nombre
+ * de votants.
+ *
+ * @param[in] file nom/path du fichier csv (format ballot)
+ * @param[in] fun fonction appelée pour chaque votant
+ * @param[in,out] states état de chaque thread (nb_threads états)
+ * @param[in] nb_threads nombre de threads
+ * @pre 1 <= nb_threads <= @ref PARALLEL_MAX_THREADS
+ *
+ * @return nombre de votants lus
+*/
+unsigned csvForEachBallotParallel(char *file, fun_ballot fun, void **states, unsigned nb_threads);
 #endif
\ No newline at end of file
@@ -0,0 +1,112 @@
+/**
+ * @file parallel.c
+ * @brief Outils de parallélisation des traitements (threads POSIX)
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "parallel.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "../logger.h"
+
+
+/* nombre de threads choisi (0 = nombre de processeurs) */
+static unsigned nb_threads_set = 0;
+
+
+/**
+ * @date 16/10/2026
+ * @brief Contexte d'un thread de travail
+ */
+typedef struct s_parallel_task {
+    fun_parallel fun;   /* fonction à exécuter */
+    unsigned id;        /* identifiant du thread */
+    unsigned nb_threads;/* nombre de threads */
+    void *arg;          /* argument partagé */
+} ParallelTask;
+
+
+/**
+ * @date 16/10/2026
+ * @brief Point d'entrée des threads créés par parallelRun
+ */
+void *parallelTaskStart(void *task) {
+    ParallelTask *t = (ParallelTask*)task;
+    t->fun(t->id, t->nb_threads, t->arg);
+    return NULL;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie le nombre de threads à utiliser pour les traitements parallèles
+ */
+unsigned parallelNbThreads() {
+    if(nb_threads_set != 0)
+        return nb_threads_set;
+
+    long nb_cpu = sysconf(_SC_NPROCESSORS_ONLN);
+    if(nb_cpu < 1) return 1;
+    if(nb_cpu > PARALLEL_MAX_THREADS) return PARALLEL_MAX_THREADS;
+    return (unsigned)nb_cpu;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Modifie le nombre de threads à utiliser pour les traitements parallèles
+ */
+void parallelSetNbThreads(unsigned nb_threads) {
+    if(nb_threads > PARALLEL_MAX_THREADS)
+        exitl("parallel.c", "parallelSetNbThreads", EXIT_FAILURE, "nombre de threads invalide (%u > %u)", nb_threads, PARALLEL_MAX_THREADS);
+    nb_threads_set = nb_threads;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Exécute fun sur nb_threads threads et attend leur terminaison
+ */
+void parallelRun(fun_parallel fun, unsigned nb_threads, void *arg) {
+#ifdef DEBUG
+    if(fun == NULL)
+        exitl("parallel.c", "parallelRun", EXIT_FAILURE, "fun NULL");
+#endif
+    if(nb_threads < 1 || nb_threads > PARALLEL_MAX_THREADS)
+        exitl("parallel.c", "parallelRun", EXIT_FAILURE, "nombre de threads invalide (%u)", nb_threads);
+
+    if(nb_threads == 1) {
+        fun(0, 1, arg);
+        return;
+    }
+
+    pthread_t threads[PARALLEL_MAX_THREADS];
+    ParallelTask tasks[PARALLEL_MAX_THREADS];
+    for(unsigned i = 0; i < nb_threads; i++) {
+        tasks[i].fun = fun;
+        tasks[i].id = i;
+        tasks[i].nb_threads = nb_threads;
+        tasks[i].arg = arg;
+    }
+
+    /* le thread appelant traite la part 0 */
+    for(unsigned i = 1; i < nb_threads; i++)
+        if(pthread_create(&threads[i], NULL, parallelTaskStart, &tasks[i]) != 0)
+            exitl("parallel.c", "parallelRun", EXIT_FAILURE, "Echec création thread %u", i);
+    fun(0, nb_threads, arg);
+
+    for(unsigned i = 1; i < nb_threads; i++)
+        pthread_join(threads[i], NULL);
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Calcule la part [begin, end[ de l'intervalle [0, size[ traitée par le thread id
+ */
+void parallelSplit(unsigned size, unsigned id, unsigned nb_threads, unsigned *begin, unsigned *end) {
+    *begin = (unsigned)((unsigned long long)size * id / nb_threads);
+    *end = (unsigned)((unsigned long long)size * (id + 1) / nb_threads);
+}
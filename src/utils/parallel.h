@@ -0,0 +1,76 @@
+/**
+ * @file parallel.h
+ * @brief Outils de parallélisation des traitements (threads POSIX)
+ *
+ * Les traitements parallèles suivent un modèle fork-join : une fonction de travail est
+ * exécutée par nb_threads threads qui reçoivent chacun leur identifiant, l'appelant
+ * attend la fin de tous les threads avant de continuer.
+ *
+ * Le nombre de threads utilisé par défaut par les modules est le nombre de processeurs
+ * disponibles, il peut être modifié avec @ref parallelSetNbThreads.
+ *
+ * @remark En cas d'erreur, toutes les fonctions exit le progamme avec un
+ * message d'erreur
+ */
+#ifndef __PARALLEL_H__
+#define __PARALLEL_H__
+
+/* nombre maximum de threads d'un traitement parallèle */
+#define PARALLEL_MAX_THREADS 256
+
+/**
+ * @date 16/10/2026
+ * @brief Type des fonctions exécutées par les threads
+ *
+ * @param[in] id identifiant du thread (0 <= id < nb_threads)
+ * @param[in] nb_threads nombre de threads du traitement
+ * @param[in] arg argument partagé entre les threads
+ */
+typedef void (*fun_parallel)(unsigned id, unsigned nb_threads, void *arg);
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie le nombre de threads à utiliser pour les traitements parallèles
+ *
+ * @return nombre de threads (>= 1)
+ */
+unsigned parallelNbThreads();
+
+/**
+ * @date 16/10/2026
+ * @brief Modifie le nombre de threads à utiliser pour les traitements parallèles
+ *
+ * @param[in] nb_threads nombre de threads, 0 pour utiliser le nombre de processeurs
+ * @pre nb_threads <= @ref PARALLEL_MAX_THREADS
+ */
+void parallelSetNbThreads(unsigned nb_threads);
+
+/**
+ * @date 16/10/2026
+ * @brief Exécute fun sur nb_threads threads et attend leur terminaison
+ *
+ * @param[in] fun fonction à exécuter
+ * @param[in] nb_threads nombre de threads
+ * @param[in] arg argument transmis à chaque thread
+ * @pre fun != NULL
+ * @pre 1 <= nb_threads <= @ref PARALLEL_MAX_THREADS
+ *
+ * @note le thread d'identifiant 0 est le thread appelant
+ */
+void parallelRun(fun_parallel fun, unsigned nb_threads, void *arg);
+
+/**
+ * @date 16/10/2026
+ * @brief Calcule la part [begin, end[ de l'intervalle [0, size[ traitée par le thread id
+ *
+ * @param[in] size taille de l'intervalle à découper
+ * @param[in] id identifiant du thread
+ * @param[in] nb_threads nombre de threads
+ * @param[out] begin début de la part du thread
+ * @param[out] end fin (exclue) de la part du thread
+ *
+ * @note les parts sont contiguës, ordonnées par id et de tailles égales à 1 près
+ */
+void parallelSplit(unsigned size, unsigned id, unsigned nb_threads, unsigned *begin, unsigned *end);
+
+#endif
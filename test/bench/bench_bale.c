@@ -0,0 +1,106 @@
+/**
+ * @file bench_bale.c
+ * @brief Benchmark des structures Bale/Matrix sur de grands ballots synthétiques
+ *
+ * Mesure le temps de construction d'un ballot, de sa conversion en matrice de duel
+ * et des parcours ligne par ligne (premier tour) et colonne par colonne (jugement
+ * majoritaire).
+ *
+ * Usage : bbale [nb_votants nb_candidats] (plusieurs couples possibles)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../src/logger.h"
+#include "../../src/structure/bale.h"
+#include "../../src/structure/duel.h"
+#include "../../src/structure/genericlist.h"
+#include "bench_utils.h"
+
+/*
+    ====================
+    === OUTILS BENCH ===
+    ====================
+*/
+
+/**
+ * @date 16/10/2026
+ * @brief Affiche une mesure formatée
+ */
+void printMeasure(const char *name, double seconds) {
+    printf("  %-32s : %10.2f ms\n", name, seconds * 1000);
+}
+
+
+/*
+    ==================
+    === BENCHMARKS ===
+    ==================
+*/
+
+/**
+ * @date 16/10/2026
+ * @brief Exécute toutes les mesures sur un ballot synthétique nb_voter x nb_candidat
+ */
+void benchBale(unsigned nb_voter, unsigned nb_candidat) {
+    double t;
+    long checksum = 0;
+    printf("\nBallot synthétique (%u votants, %u candidats)\n", nb_voter, nb_candidat);
+
+    /* construction */
+    t = now();
+    Bale *bale = createSyntheticBale(nb_voter, nb_candidat, false);
+    printMeasure("createBale + baleSetValue", now() - t);
+
+    /* conversion en duel */
+    t = now();
+    Duel *duel = duelFromBale(bale);
+    printMeasure("duelFromBale", now() - t);
+    checksum += duelGetValue(duel, 0, nb_candidat - 1);
+    deleteDuel(&duel);
+
+    /* parcours colonne par colonne */
+    t = now();
+    for (unsigned c = 0; c < nb_candidat; c++)
+        for (unsigned l = 0; l < nb_voter; l++)
+            checksum += baleGetValue(bale, l, c);
+    printMeasure("parcours colonnes (baleGetValue)", now() - t);
+
+    /* parcours ligne par ligne (recherche du premier choix) */
+    t = now();
+    for (unsigned l = 0; l < nb_voter; l++) {
+        GenList *min = baleMin(bale, l, -1);
+        checksum += genListSize(min);
+        while (!genListEmpty(min))
+            free(genListPop(min));
+        deleteGenList(&min);
+    }
+    printMeasure("parcours lignes (baleMin)", now() - t);
+
+    /* décompte direct des premiers choix */
+    unsigned *count = calloc(nb_candidat, sizeof(unsigned));
+    t = now();
+    baleCountFirstChoices(bale, 0, baleNbLine(bale), count);
+    printMeasure("premiers choix (comptage direct)", now() - t);
+    checksum += count[0];
+    free(count);
+
+    deleteBale(&bale);
+    printf("  (checksum %ld)\n", checksum);
+}
+
+
+int main(int argc, char *argv[]) {
+    init_logger(NULL);
+
+    if (argc < 3) {
+        benchBale(200000, 10);
+        benchBale(20000, 100);
+    } else {
+        for (int i = 1; i + 1 < argc; i += 2)
+            benchBale(atoi(argv[i]), atoi(argv[i + 1]));
+    }
+
+    close_logger();
+    return 0;
+}
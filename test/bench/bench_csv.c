@@ -0,0 +1,45 @@
+/**
+ * @file bench_csv.c
+ * @brief Benchmark de la lecture d'un ballot csv selon le nombre de threads
+ *
+ * Génère un fichier csv synthétique puis mesure csvToBaleParallel avec 1, 2, 4, ...
+ * threads jusqu'au nombre de processeurs.
+ *
+ * Usage : bcsv [nb_votants nb_candidats [fichier]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../src/logger.h"
+#include "../../src/structure/bale.h"
+#include "../../src/utils/csv_reader.h"
+#include "../../src/utils/parallel.h"
+#include "bench_utils.h"
+
+/* fichier généré par défaut */
+#define BENCH_CSV_FILE "/tmp/bench_csv.csv"
+
+
+int main(int argc, char *argv[]) {
+    unsigned nb_voter = argc >= 3 ? (unsigned)atoi(argv[1]) : 1000000;
+    unsigned nb_candidat = argc >= 3 ? (unsigned)atoi(argv[2]) : 10;
+    char *file = argc >= 4 ? argv[3] : BENCH_CSV_FILE;
+    double t, t_ref = 0;
+    init_logger(NULL);
+
+    writeSyntheticCsv(file, nb_voter, nb_candidat);
+    printf("\nLecture csv (%u votants, %u candidats)\n", nb_voter, nb_candidat);
+
+    for (unsigned nb_threads = 1; nb_threads <= parallelNbThreads(); nb_threads *= 2) {
+        t = now();
+        Bale *bale = csvToBaleParallel(file, nb_threads);
+        t = now() - t;
+        if (nb_threads == 1) t_ref = t;
+        printf("  %3u thread(s) : %10.2f ms  (x%.2f)\n", nb_threads, t * 1000, t_ref / t);
+        deleteBale(&bale);
+    }
+
+    if (argc < 4) remove(file);
+    close_logger();
+    return 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file bench_ranked_pairs.c
+ * @brief Benchmark de la méthode de Condorcet par rangement des paires
+ *
+ * Mesure le temps de @ref theWinnerRankedPairs sur des tournois réguliers (chaque candidat
+ * gagne exactement la moitié de ses duels) : le critère de Condorcet ne désigne alors aucun
+ * vainqueur et toute la méthode (tri des C²/2 paires puis verrouillage) est exécutée.
+ *
+ * Usage : brankedpairs [nb_candidats...] (nombres impairs)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../src/logger.h"
+#include "../../src/structure/duel.h"
+#include "../../src/structure/genericlist.h"
+#include "../../src/module/condorcet.h"
+#include "bench_utils.h"
+
+/* nombre de votants simulés par duel */
+#define NB_VOTER 1000
+
+
+/*
+    ====================
+    === OUTILS BENCH ===
+    ====================
+*/
+
+/**
+ * @date 16/10/2026
+ * @brief Crée un tournoi régulier : le candidat i bat les nb_candidat / 2 suivants
+ * (modulo nb_candidat) avec un score aléatoire et reproductible
+ *
+ * @param[in] nb_candidat Nombre de candidats (impair)
+ * @return matrice de duels remplie
+ */
+Duel *createRegularTournament(unsigned nb_candidat) {
+    char *label;
+    unsigned j;
+    int w;
+    GenList *labels = createGenList(nb_candidat);
+    for (unsigned c = 0; c < nb_candidat; c++) {
+        label = malloc(MAX_LENGHT_LABEL);
+        snprintf(label, MAX_LENGHT_LABEL, "C%u", c);
+        genListAdd(labels, label);
+    }
+
+    Duel *duel = createDuel(nb_candidat, labels);
+    while (!genListEmpty(labels))
+        free(genListPop(labels));
+    deleteGenList(&labels);
+
+    srand(42);
+    for (unsigned i = 0; i < nb_candidat; i++) {
+        duelSetValue(duel, i, i, 0);
+        for (unsigned k = 1; k <= nb_candidat / 2; k++) {
+            j = (i + k) % nb_candidat;
+            w = NB_VOTER / 2 + 1 + rand() % (NB_VOTER / 2 - 1);
+            duelSetValue(duel, i, j, w);
+            duelSetValue(duel, j, i, NB_VOTER - w);
+        }
+    }
+    return duel;
+}
+
+
+/*
+    ==================
+    === BENCHMARKS ===
+    ==================
+*/
+
+/**
+ * @date 16/10/2026
+ * @brief Mesure le rangement des paires sur un tournoi régulier de nb_candidat candidats
+ */
+void benchRankedPairs(unsigned nb_candidat) {
+    double t;
+    Duel *duel = createRegularTournament(nb_candidat);
+
+    t = now();
+    GenList *winners = theWinnerRankedPairs(duel);
+    t = now() - t;
+
+    printf("  %5u candidats : %10.2f ms  (%u gagnant(s))\n", nb_candidat, t * 1000, genListSize(winners));
+
+    while (!genListEmpty(winners))
+        free(genListPop(winners));
+    deleteGenList(&winners);
+    deleteDuel(&duel);
+}
+
+
+int main(int argc, char *argv[]) {
+    unsigned sizes[] = {11, 51, 101, 251, 501, 1001};
+    init_logger(NULL);
+
+    printf("\nRangement des paires sur des tournois réguliers\n");
+    if (argc < 2) {
+        for (unsigned i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+            benchRankedPairs(sizes[i]);
+    } else {
+        for (int i = 1; i < argc; i++)
+            benchRankedPairs(atoi(argv[i]));
+    }
+
+    close_logger();
+    return 0;
+}
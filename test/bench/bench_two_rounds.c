@@ -0,0 +1,122 @@
+/**
+ * @file bench_two_rounds.c
+ * @brief Benchmark du scrutin uninominal à deux tours : ballot construit contre lecture csv
+ *
+ * Génère un fichier csv synthétique puis compare la commande uni2 avec ballot (csvToBale,
+ * baleCompact puis @ref theWinnerTwoRounds) à @ref theWinnerTwoRoundsCsv, qui lit les votants
+ * sans construire le ballot (résumé des duels au premier tour, ou nouvelle lecture du fichier
+ * au-delà de quelques dizaines de candidats).
+ *
+ * Usage : btworounds [nb_votants nb_candidats] (plusieurs couples possibles)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../src/logger.h"
+#include "../../src/structure/bale.h"
+#include "../../src/structure/genericlist.h"
+#include "../../src/utils/csv_reader.h"
+#include "../../src/module/single_member.h"
+#include "bench_utils.h"
+
+/* fichier généré */
+#define BENCH_CSV_FILE "/tmp/bench_two_rounds.csv"
+/* nombre de mesures, la meilleure est retenue */
+#define NB_RUN 3
+
+
+/*
+    ====================
+    === OUTILS BENCH ===
+    ====================
+*/
+
+/**
+ * @date 16/10/2026
+ * @brief Libère une liste de gagnants
+ */
+void deleteWinners(GenList **winners) {
+    while (!genListEmpty(*winners))
+        free(genListPop(*winners));
+    deleteGenList(winners);
+}
+
+/**
+ * @date 16/10/2026
+ * @brief Vrai si les deux listes de WinnerSingleTwo sont identiques
+ */
+bool sameWinners(GenList *a, GenList *b) {
+    WinnerSingleTwo *wa, *wb;
+    if (genListSize(a) != genListSize(b)) return false;
+    for (unsigned i = 0; i < genListSize(a); i++) {
+        wa = genListGet(a, i);
+        wb = genListGet(b, i);
+        if (strcmp(wa->name, wb->name) != 0 || wa->score != wb->score || wa->round != wb->round)
+            return false;
+    }
+    return true;
+}
+
+
+/*
+    ==================
+    === BENCHMARKS ===
+    ==================
+*/
+
+/**
+ * @date 16/10/2026
+ * @brief Compare les deux lectures sur un fichier csv synthétique nb_voter x nb_candidat
+ */
+void benchTwoRounds(unsigned nb_voter, unsigned nb_candidat) {
+    double t, t_bale = 1e9, t_csv = 1e9;
+    GenList *winners_bale = NULL, *winners_csv = NULL;
+    Bale *bale, *compact;
+
+    printf("\nFichier csv synthétique (%u votants, %u candidats)\n", nb_voter, nb_candidat);
+    writeSyntheticCsv(BENCH_CSV_FILE, nb_voter, nb_candidat);
+
+    for (unsigned r = 0; r < NB_RUN; r++) {
+        if (winners_bale != NULL) deleteWinners(&winners_bale);
+        t = now();
+        bale = csvToBale(BENCH_CSV_FILE);
+        compact = baleCompact(bale);
+        deleteBale(&bale);
+        winners_bale = theWinnerTwoRounds(compact);
+        deleteBale(&compact);
+        t = now() - t;
+        t_bale = t < t_bale ? t : t_bale;
+
+        if (winners_csv != NULL) deleteWinners(&winners_csv);
+        t = now();
+        winners_csv = theWinnerTwoRoundsCsv(BENCH_CSV_FILE, NULL, NULL);
+        t = now() - t;
+        t_csv = t < t_csv ? t : t_csv;
+    }
+
+    printf("  %-32s : %10.2f ms\n", "ballot construit", t_bale * 1000);
+    printf("  %-32s : %10.2f ms%s\n", "lecture csv", t_csv * 1000,
+           sameWinners(winners_bale, winners_csv) ? "" : "  (gagnants différents !)");
+
+    deleteWinners(&winners_bale);
+    deleteWinners(&winners_csv);
+    remove(BENCH_CSV_FILE);
+}
+
+
+int main(int argc, char *argv[]) {
+    unsigned sizes[] = {3, 6, 10, 20, 40};
+    init_logger(NULL);
+
+    if (argc < 3) {
+        for (unsigned i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+            benchTwoRounds(1000000, sizes[i]);
+    } else {
+        for (int i = 1; i + 1 < argc; i += 2)
+            benchTwoRounds(atoi(argv[i]), atoi(argv[i + 1]));
+    }
+
+    close_logger();
+    return 0;
+}
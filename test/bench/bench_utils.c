@@ -0,0 +1,77 @@
+/**
+ * @file bench_utils.c
+ * @brief Outils communs des benchmarks
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../../src/logger.h"
+#include "../../src/structure/genericlist.h"
+#include "bench_utils.h"
+
+
+/**
+ * @date 16/10/2026
+ */
+double now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/**
+ * @date 16/10/2026
+ */
+Bale *createSyntheticBale(unsigned nb_line, unsigned nb_candidat, bool weighted) {
+    char *label;
+    GenList *labels = createGenList(nb_candidat);
+    for (unsigned c = 0; c < nb_candidat; c++) {
+        label = malloc(MAX_LENGHT_LABEL);
+        snprintf(label, MAX_LENGHT_LABEL, "Candidat %u", c);
+        genListAdd(labels, label);
+    }
+
+    Bale *bale = createBale(nb_line, nb_candidat, labels);
+    while (!genListEmpty(labels))
+        free(genListPop(labels));
+    deleteGenList(&labels);
+
+    srand(42);
+    for (unsigned l = 0; l < nb_line; l++) {
+        for (unsigned c = 0; c < nb_candidat; c++) {
+            if (rand() % 100 < PERCENT_ABSTENTION)
+                baleSetValue(bale, l, c, -1);
+            else
+                baleSetValue(bale, l, c, 1 + rand() % nb_candidat);
+        }
+        if (weighted)
+            baleSetLineWeight(bale, l, 1 + rand() % 4);
+    }
+    return bale;
+}
+
+/**
+ * @date 16/10/2026
+ */
+void writeSyntheticCsv(const char *file, unsigned nb_voter, unsigned nb_candidat) {
+    FILE *f = fopen(file, "w");
+    if (f == NULL)
+        exitl("bench_utils.c", "writeSyntheticCsv", EXIT_FAILURE, "Echec ouverture %s", file);
+
+    fprintf(f, "Réponse,Soumis le :,Cours,Nom complet");
+    for (unsigned c = 0; c < nb_candidat; c++)
+        fprintf(f, ",Candidat %u", c);
+    fprintf(f, "\n");
+
+    srand(42);
+    for (unsigned l = 0; l < nb_voter; l++) {
+        fprintf(f, "%u,16/10/2026 10:00:00,Bench,%08x", l, rand());
+        for (unsigned c = 0; c < nb_candidat; c++)
+            fprintf(f, ",%d", rand() % 20 == 0 ? -1 : 1 + rand() % (int)nb_candidat);
+        fprintf(f, "\n");
+    }
+    fclose(f);
+}
@@ -0,0 +1,42 @@
+/**
+ * @file bench_utils.h
+ * @brief Outils communs des benchmarks : horloge et données synthétiques reproductibles
+ */
+
+#ifndef __BENCH_UTILS_H__
+#define __BENCH_UTILS_H__
+
+#include <stdbool.h>
+#include "../../src/structure/bale.h"
+
+/* probabilité (en %) qu'un votant ne classe pas un candidat (-1) */
+#define PERCENT_ABSTENTION 5
+
+/**
+ * @date 16/10/2026
+ * @brief Renvoie le temps courant en secondes (horloge monotone)
+ */
+double now(void);
+
+/**
+ * @date 16/10/2026
+ * @brief Crée un ballot synthétique (classements aléatoires et reproductibles)
+ *
+ * @param[in] nb_line Nombre de lignes
+ * @param[in] nb_candidat Nombre de candidats
+ * @param[in] weighted true pour donner à chaque ligne un poids aléatoire de 1 à 4
+ * @return ballot rempli
+ */
+Bale *createSyntheticBale(unsigned nb_line, unsigned nb_candidat, bool weighted);
+
+/**
+ * @date 16/10/2026
+ * @brief Génère un ballot csv synthétique au format des exports (4 colonnes ignorées)
+ *
+ * @param[in] file nom/path du fichier à écrire
+ * @param[in] nb_voter Nombre de votants
+ * @param[in] nb_candidat Nombre de candidats
+ */
+void writeSyntheticCsv(const char *file, unsigned nb_voter, unsigned nb_candidat);
+
+#endif
@@ -160,6 +160,35 @@ bool testMinimax() {
 }
 
 
+bool testMinimaxShared() {
+    Arena* arena = createArena(0);
+    Arena* arena_method = createArena(0);
+    CondorcetShared* shared;
+    GenList* lwinner;
+    Duel* duel;
+    char file[64];
+    unsigned num_tests[] = {4, 5, 6, 7, 10, 11, 12};
+
+    for(unsigned i = 0; i < 7; i++) {
+        printsb("\ntest sur prétraitement partagé...");
+        sprintf(file, "test/ressource/duel_%u.csv", num_tests[i]);
+        duel = csvToDuel(file);
+        shared = createCondorcetShared(duel, arena);
+        lwinner = theWinnerMinimaxShared(shared, arena_method);
+        if(!verifResultMinimax(lwinner, num_tests[i])) return false;
+        deleteGenList(&lwinner);
+        arenaReset(arena_method);
+        deleteCondorcetShared(&shared, arena);
+        arenaReset(arena);
+        deleteDuel(&duel);
+        printsb( "\n\t- test passé\n");
+    }
+
+    deleteArena(&arena_method);
+    deleteArena(&arena);
+    return true;
+}
+
 
 void test_fun(bool(*f)(), int fnb, char* fname) {
     beforeEach();
@@ -177,6 +206,7 @@ int main() {
     beforeAll();
 
     test_fun(testMinimax, 1, "testMinimax");
+    test_fun(testMinimaxShared, 2, "testMinimaxShared");
 
     
     afterAll();
@@ -25,7 +25,7 @@
 #define NB_DUEL 20
 #define MAX_NB_WINNER 10
 
-unsigned nb_winners_ref[NB_DUEL] = {0,0,0,0,1,1,1,1,0,0,1};
+unsigned nb_winners_ref[NB_DUEL] = {0,0,0,0,1,1,1,1,0,0,1,0,0,1};
 char label_winners_ref[NB_DUEL][MAX_NB_WINNER][MAX_LENGHT_LABEL] = {
     {""},{""},{""},{""},
     {"C3"},         // 4
@@ -33,7 +33,9 @@ char label_winners_ref[NB_DUEL][MAX_NB_WINNER][MAX_LENGHT_LABEL] = {
     {"C1"},         // 6
     {"C3"},         // 7
     {""},{""},
-    {"C4"}          // 10
+    {"C4"},         // 10
+    {""},{""},
+    {"C14"}         // 13 (101 candidats, tournoi régulier)
 
 };
 
@@ -142,11 +144,44 @@ bool testRankedPairs() {
     if(!testRankedPairsOnDuel("test/ressource/duel_10.csv",10)) return false;
     printsb( "\n\t- test passé\n");
 
+    printsb("\ntest sur duel 13...");
+    if(!testRankedPairsOnDuel("test/ressource/duel_13.csv",13)) return false;
+    printsb( "\n\t- test passé\n");
+
     return true;
 
 }
 
 
+bool testRankedPairsShared() {
+    Arena* arena = createArena(0);
+    Arena* arena_method = createArena(0);
+    CondorcetShared* shared;
+    GenList* lwinner;
+    Duel* duel;
+    char file[64];
+    unsigned num_tests[] = {4, 5, 6, 7, 10, 13};
+
+    for(unsigned i = 0; i < 6; i++) {
+        printsb("\ntest sur prétraitement partagé...");
+        sprintf(file, "test/ressource/duel_%u.csv", num_tests[i]);
+        duel = csvToDuel(file);
+        shared = createCondorcetShared(duel, arena);
+        lwinner = theWinnerRankedPairsShared(shared, arena_method);
+        if(!verifResultMinimax(lwinner, num_tests[i])) return false;
+        deleteGenList(&lwinner);
+        arenaReset(arena_method);
+        deleteCondorcetShared(&shared, arena);
+        arenaReset(arena);
+        deleteDuel(&duel);
+        printsb( "\n\t- test passé\n");
+    }
+
+    deleteArena(&arena_method);
+    deleteArena(&arena);
+    return true;
+}
+
 
 void test_fun(bool(*f)(), int fnb, char* fname) {
     beforeEach();
@@ -164,6 +199,7 @@ int main() {
     beforeAll();
 
     test_fun(testRankedPairs, 1, "testRankedPairs");
+    test_fun(testRankedPairsShared, 2, "testRankedPairsShared");
 
     
     afterAll();
@@ -14,13 +14,14 @@
 #include "../test_utils.h"
 #include "../../src/utils/csv_reader.h"
 #include "../../src/module/condorcet.h"
+#include "../../src/utils/parallel.h"
 
 
 
 #define NB_DUEL 20
 #define MAX_NB_WINNER 10
 
-unsigned nb_winners_ref[NB_DUEL] = {0,0,0,0,3,2,1,3,0,0,2,1,2};
+unsigned nb_winners_ref[NB_DUEL] = {0,0,0,0,3,2,1,3,0,0,2,1,2,1};
 char label_winners_ref[NB_DUEL][MAX_NB_WINNER][MAX_LENGHT_LABEL] = {
     {""},{""},{""},{""},
     {"C1","C2","C3"},   // 4
@@ -30,7 +31,8 @@ char label_winners_ref[NB_DUEL][MAX_NB_WINNER][MAX_LENGHT_LABEL] = {
     {""},{""},
     {"C1","C4"},        // 10
     {"E"},              // 11
-    {"B","D"}           // 12
+    {"B","D"},          // 12
+    {"C32"}             // 13
 };
 
 
@@ -149,10 +151,108 @@ bool testSchulze() {
     if(!testSchulzeOnDuel("test/ressource/duel_12.csv",12)) return false;
     printsb( "\n\t- test passé\n");
 
+    printsb("\ntest sur duel 13 (101 candidats, chemins calculés par blocs)...");
+    if(!testSchulzeOnDuel("test/ressource/duel_13.csv",13)) return false;
+    printsb( "\n\t- test passé\n");
+
+    return true;
+
+}
+
+
+bool testSchulzeParallel() {
+    unsigned nb_threads[] = {1, 2, 3, 5};
+
+    for(unsigned i = 0; i < 4; i++) {
+        parallelSetNbThreads(nb_threads[i]);
+
+        printsb("\ntest sur duel 12...");
+        if(!testSchulzeOnDuel("test/ressource/duel_12.csv",12)) return false;
+        printsb( "\n\t- test passé\n");
+
+        printsb("\ntest sur duel 13...");
+        if(!testSchulzeOnDuel("test/ressource/duel_13.csv",13)) return false;
+        printsb( "\n\t- test passé\n");
+    }
+    parallelSetNbThreads(0);
+
+    return true;
+}
+
+
+bool testSchulzeArena() {
+    Arena* arena = createArena(0);
+    GenList* lwinner;
+    Duel* duel;
+    char* files[] = {"test/ressource/duel_12.csv", "test/ressource/duel_13.csv"};
+    unsigned num_tests[] = {12, 13};
+
+    for(unsigned i = 0; i < 2; i++) {
+        printsb("\ntest avec arène...");
+        duel = csvToDuel(files[i]);
+        lwinner = theWinnerSchulzeArena(duel, arena);
+        if(!verifResultSchulze(lwinner, num_tests[i])) return false;
+        /* les gagnants appartiennent à l'arène : seule la liste est supprimée */
+        deleteGenList(&lwinner);
+        arenaReset(arena);
+        deleteDuel(&duel);
+        printsb( "\n\t- test passé\n");
+    }
+
+    deleteArena(&arena);
     return true;
+}
+
+
+/* nombre de threads qui calculent en même temps sur un prétraitement partagé */
+#define NB_SHARED_THREADS 4
 
+/**
+ * @date 16/10/2026
+ * @brief Méthode de Schulze sur le prétraitement partagé, une arène par thread
+ */
+typedef struct s_shared_run {
+    CondorcetShared* shared;
+    Arena* arenas[NB_SHARED_THREADS];
+    GenList* winners[NB_SHARED_THREADS];
+} SharedRun;
+
+void sharedSchulzeThread(unsigned id, unsigned nb_threads, void* arg) {
+    (void)nb_threads;
+    SharedRun* run = (SharedRun*)arg;
+    run->winners[id] = theWinnerSchulzeShared(run->shared, run->arenas[id]);
 }
 
+bool testSchulzeShared() {
+    SharedRun run;
+    Duel* duel;
+    char file[64];
+    unsigned num_tests[] = {4, 5, 6, 7, 10, 11, 12, 13};
+
+    for(unsigned t = 0; t < NB_SHARED_THREADS; t++)
+        run.arenas[t] = createArena(0);
+
+    for(unsigned i = 0; i < 8; i++) {
+        printsb("\ntest prétraitement partagé entre threads...");
+        sprintf(file, "test/ressource/duel_%u.csv", num_tests[i]);
+        duel = csvToDuel(file);
+        run.shared = createCondorcetShared(duel, NULL);
+        parallelRun(sharedSchulzeThread, NB_SHARED_THREADS, &run);
+        for(unsigned t = 0; t < NB_SHARED_THREADS; t++) {
+            if(!verifResultSchulze(run.winners[t], num_tests[i])) return false;
+            deleteGenList(&run.winners[t]);
+            arenaReset(run.arenas[t]);
+        }
+        deleteCondorcetShared(&run.shared, NULL);
+        if(run.shared != NULL) return echecTest("pointeur non NULL après suppression");
+        deleteDuel(&duel);
+        printsb( "\n\t- test passé\n");
+    }
+
+    for(unsigned t = 0; t < NB_SHARED_THREADS; t++)
+        deleteArena(&run.arenas[t]);
+    return true;
+}
 
 
 void test_fun(bool(*f)(), int fnb, char* fname) {
@@ -171,6 +271,9 @@ int main() {
     beforeAll();
 
     test_fun(testSchulze, 1, "testSchulze");
+    test_fun(testSchulzeParallel, 2, "testSchulzeParallel");
+    test_fun(testSchulzeArena, 4, "testSchulzeArena");
+    test_fun(testSchulzeShared, 8, "testSchulzeShared");
 
     
     afterAll();
@@ -14,6 +14,7 @@
 #include "../test_utils.h"
 #include "../../src/utils/csv_reader.h"
 #include "../../src/module/majority_judgment.h"
+#include "../../src/utils/parallel.h"
 
 
 /*
@@ -24,6 +25,11 @@
 
 #define NB_BALE 20
 #define MAX_NB_WINNER 10
+/* nombre d'élections évaluées en même temps */
+#define NB_PARALLEL_BALE 7
+/* ballots aléatoires du test des poids */
+#define NB_RANDOM_LINES 60
+#define NB_RANDOM_CANDIDAT 5
 
 unsigned nb_winners_ref[NB_BALE] = {0,0,0,4,3,1,0,1,0,0,2,1,1};
 char label_winners_ref[NB_BALE][MAX_NB_WINNER][MAX_LENGHT_LABEL] = {
@@ -97,13 +103,19 @@ bool verifResultMajorityJudgment(GenList* result, unsigned num_test) {
 
 
 
-bool testMajorityJudgmentOnDuel(char* file, unsigned num_test, bool is_bale_judgment) {
+bool testMajorityJudgmentOnDuel(char* file, unsigned num_test, bool is_bale_judgment, bool compact) {
     GenList* lwinner;
     Bale* bale;
     
     /* chargment du bale */
     printsb("\n\t- chargement ballot");
     bale = csvToBale(file);
+    if(compact) {
+        /* mêmes résultats attendus avec les ballots identiques regroupés */
+        Bale* weighted = baleCompact(bale);
+        deleteBale(&bale);
+        bale = weighted;
+    }
 
     /* calcul des gagnants */
     printsb("\n\t- calcul");
@@ -129,31 +141,31 @@ bool testMajorityJudgmentOnDuel(char* file, unsigned num_test, bool is_bale_judg
 bool testTheWinnerMajorityJudgment() {
 
     printsb("\ntest sur bale 3...");
-    if(!testMajorityJudgmentOnDuel("test/ressource/bale_3.csv",3,false)) return false;
+    if(!testMajorityJudgmentOnDuel("test/ressource/bale_3.csv",3,false, false) || !testMajorityJudgmentOnDuel("test/ressource/bale_3.csv",3,false, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur bale 4...");
-    if(!testMajorityJudgmentOnDuel("test/ressource/bale_4.csv", 4,false)) return false;
+    if(!testMajorityJudgmentOnDuel("test/ressource/bale_4.csv", 4,false, false) || !testMajorityJudgmentOnDuel("test/ressource/bale_4.csv", 4,false, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur bale 5...");
-    if(!testMajorityJudgmentOnDuel("test/ressource/bale_5.csv", 5,false)) return false;
+    if(!testMajorityJudgmentOnDuel("test/ressource/bale_5.csv", 5,false, false) || !testMajorityJudgmentOnDuel("test/ressource/bale_5.csv", 5,false, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur bale 7...");
-    if(!testMajorityJudgmentOnDuel("test/ressource/bale_7.csv", 7,false)) return false;
+    if(!testMajorityJudgmentOnDuel("test/ressource/bale_7.csv", 7,false, false) || !testMajorityJudgmentOnDuel("test/ressource/bale_7.csv", 7,false, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur bale 10...");
-    if(!testMajorityJudgmentOnDuel("test/ressource/bale_10.csv", 10,false)) return false;
+    if(!testMajorityJudgmentOnDuel("test/ressource/bale_10.csv", 10,false, false) || !testMajorityJudgmentOnDuel("test/ressource/bale_10.csv", 10,false, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur bale 11...");
-    if(!testMajorityJudgmentOnDuel("test/ressource/bale_11.csv", 11,false)) return false;
+    if(!testMajorityJudgmentOnDuel("test/ressource/bale_11.csv", 11,false, false) || !testMajorityJudgmentOnDuel("test/ressource/bale_11.csv", 11,false, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur bale 12...");
-    if(!testMajorityJudgmentOnDuel("test/ressource/bale_12.csv", 12,true)) return false;
+    if(!testMajorityJudgmentOnDuel("test/ressource/bale_12.csv", 12,true, false) || !testMajorityJudgmentOnDuel("test/ressource/bale_12.csv", 12,true, true)) return false;
     printsb( "\n\t- test passé\n");
 
     
@@ -167,6 +179,227 @@ bool testTheWinnerMajorityJudgment() {
 
 
 
+/**
+ * @date 16/10/2026
+ * @brief Compare deux listes de gagnants (noms, médianes et pourcentages)
+ */
+bool sameWinners(GenList* l1, GenList* l2) {
+    WinnerMajorityJudgment *w1, *w2;
+    if(genListSize(l1) != genListSize(l2)) return false;
+    for(unsigned i = 0; i < genListSize(l1); i++) {
+        w1 = genListGet(l1, i);
+        w2 = genListGet(l2, i);
+        if(strcmp(w1->name, w2->name) != 0 || w1->median != w2->median
+            || w1->percent_inf != w2->percent_inf || w1->percent_sup != w2->percent_sup)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @date 16/10/2026
+ * @brief Crée un ballot aléatoire pondéré (poids 1 à 3) et le même ballot où chaque ligne
+ * est répétée autant de fois que son poids. Les notes vont de -2 à 9 (hors bornes compris).
+ */
+void createRandomBales(unsigned seed, Bale** weighted, Bale** expanded) {
+    char labels_buff[NB_RANDOM_CANDIDAT][MAX_LENGHT_LABEL];
+    GenList* labels = createGenList(NB_RANDOM_CANDIDAT);
+    for(unsigned c = 0; c < NB_RANDOM_CANDIDAT; c++) {
+        snprintf(labels_buff[c], MAX_LENGHT_LABEL, "C%u", c);
+        genListAdd(labels, labels_buff[c]);
+    }
+    unsigned weights[NB_RANDOM_LINES], nb_expanded = 0;
+    srand(seed);
+    for(unsigned l = 0; l < NB_RANDOM_LINES; l++) {
+        weights[l] = 1 + rand() % 3;
+        nb_expanded += weights[l];
+    }
+    *weighted = createBale(NB_RANDOM_LINES, NB_RANDOM_CANDIDAT, labels);
+    *expanded = createBale(nb_expanded, NB_RANDOM_CANDIDAT, labels);
+    deleteGenList(&labels);
+
+    int v;
+    for(unsigned l = 0, e = 0; l < NB_RANDOM_LINES; l++) {
+        baleSetLineWeight(*weighted, l, weights[l]);
+        for(unsigned c = 0; c < NB_RANDOM_CANDIDAT; c++) {
+            v = rand() % 12 - 2;
+            baleSetValue(*weighted, l, c, v);
+            for(unsigned k = 0; k < weights[l]; k++)
+                baleSetValue(*expanded, e + k, c, v);
+        }
+        e += weights[l];
+    }
+}
+
+bool testMajorityJudgmentWeights() {
+    Bale *weighted, *expanded;
+    GenList *lweighted, *lexpanded;
+    bool ok = true;
+
+    printsb("\ntest ballot pondéré identique au ballot aux lignes répétées...");
+    for(unsigned seed = 1; seed <= 40 && ok; seed++) {
+        createRandomBales(seed, &weighted, &expanded);
+        lweighted = theWinnerMajorityJudgment(weighted, seed % 2 == 0);
+        lexpanded = theWinnerMajorityJudgment(expanded, seed % 2 == 0);
+
+        if(!sameWinners(lweighted, lexpanded)) ok = echecTest("gagnant différent");
+
+        deleteBale(&weighted);
+        deleteBale(&expanded);
+        while(!genListEmpty(lweighted))
+            free(genListPop(lweighted));
+        deleteGenList(&lweighted);
+        while(!genListEmpty(lexpanded))
+            free(genListPop(lexpanded));
+        deleteGenList(&lexpanded);
+    }
+    if(!ok) return false;
+    printsb("\n\t- test passé\n");
+
+    return true;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Élections évaluées en parallèle, une par thread
+ */
+typedef struct {
+    Bale* bales[NB_PARALLEL_BALE];
+    bool is_bale_judgment[NB_PARALLEL_BALE];
+    GenList* results[NB_PARALLEL_BALE];
+} ParallelElections;
+
+void majorityJudgmentThread(unsigned id, unsigned nb_threads, void* arg) {
+    (void)nb_threads;
+    ParallelElections* elections = arg;
+    elections->results[id] = theWinnerMajorityJudgment(elections->bales[id], elections->is_bale_judgment[id]);
+}
+
+bool testMajorityJudgmentExactTies() {
+    GenList* labels = createGenList(2);
+    genListAdd(labels, "A");
+    genListAdd(labels, "B");
+    Bale* bale = createBale(3, 2, labels);
+    deleteGenList(&labels);
+
+    /* médiane 3 pour les deux candidats, B a un opposant de plus que A : les deux
+       pourcentages d'opposants sont égaux en float (2^25 / N et (2^25 + 1) / N) */
+    int values[3][2] = {{3, 3}, {5, 5}, {3, 5}};
+    unsigned weights[3] = {1u << 26, 1u << 25, 1};
+    for(unsigned l = 0; l < 3; l++) {
+        baleSetValue(bale, l, 0, values[l][0]);
+        baleSetValue(bale, l, 1, values[l][1]);
+        baleSetLineWeight(bale, l, weights[l]);
+    }
+
+    printsb("\ntest départage exact avec plus de 2^24 votants...");
+    GenList* lwinner = theWinnerMajorityJudgment(bale, true);
+    bool ok = genListSize(lwinner) == 1 && strcmp(((WinnerMajorityJudgment*)genListGet(lwinner, 0))->name, "A") == 0;
+    deleteBale(&bale);
+    while(!genListEmpty(lwinner))
+        free(genListPop(lwinner));
+    deleteGenList(&lwinner);
+    if(!ok) return echecTest("B non éliminé");
+    printsb("\n\t- test passé\n");
+
+    return true;
+}
+
+bool testMajorityJudgmentSparseGrades() {
+    GenList* labels = createGenList(3);
+    genListAdd(labels, "A");
+    genListAdd(labels, "B");
+    genListAdd(labels, "C");
+    Bale* bale = createBale(4, 3, labels);
+    deleteGenList(&labels);
+
+    /* rang 100000 avec 3 candidats : trop éloigné pour la partie dense, médiane 2
+       pour les trois candidats, B gagne au départage */
+    int values[4][3] = {{1, 2, 1}, {100000, 2, 3}, {100000, 3, 3}, {2, 1, 2}};
+    for(unsigned l = 0; l < 4; l++)
+        for(unsigned c = 0; c < 3; c++)
+            baleSetValue(bale, l, c, values[l][c]);
+
+    printsb("\ntest notes trop dispersées (histogramme creux)...");
+    GenList* lwinner = theWinnerMajorityJudgment(bale, false);
+    WinnerMajorityJudgment* winner = genListGet(lwinner, 0);
+    bool ok = genListSize(lwinner) == 1 && strcmp(winner->name, "B") == 0 && winner->median == 2
+        && winner->percent_inf == 0.25f && winner->percent_sup == 0.25f;
+    deleteBale(&bale);
+    while(!genListEmpty(lwinner))
+        free(genListPop(lwinner));
+    deleteGenList(&lwinner);
+    if(!ok) return echecTest("mauvais gagnant");
+    printsb("\n\t- test passé\n");
+
+    /* mentions éloignées des deux côtés : A et C ont la médiane 1, C a le plus d'opposants */
+    labels = createGenList(3);
+    genListAdd(labels, "A");
+    genListAdd(labels, "B");
+    genListAdd(labels, "C");
+    bale = createBale(5, 3, labels);
+    deleteGenList(&labels);
+    int mentions[5][3] = {{1, 3, 100000}, {1, 3, 100000}, {1, 3, 1}, {-100000, 3, 1}, {2, 3, 1}};
+    for(unsigned l = 0; l < 5; l++)
+        for(unsigned c = 0; c < 3; c++)
+            baleSetValue(bale, l, c, mentions[l][c]);
+
+    printsb("\ntest mentions éloignées des deux côtés de l'intervalle dense...");
+    lwinner = theWinnerMajorityJudgment(bale, true);
+    winner = genListGet(lwinner, 0);
+    ok = genListSize(lwinner) == 1 && strcmp(winner->name, "A") == 0 && winner->median == 1
+        && winner->percent_inf == 0.2f && winner->percent_sup == 0.2f;
+    deleteBale(&bale);
+    while(!genListEmpty(lwinner))
+        free(genListPop(lwinner));
+    deleteGenList(&lwinner);
+    if(!ok) return echecTest("mauvais gagnant");
+    printsb("\n\t- test passé\n");
+
+    return true;
+}
+
+bool testMajorityJudgmentParallel() {
+    unsigned num_bales[NB_PARALLEL_BALE] = {3, 4, 5, 7, 10, 11, 12};
+    char file[64];
+    ParallelElections elections;
+    GenList* serial[NB_PARALLEL_BALE];
+    bool ok = true;
+
+    printsb("\ntest élections évaluées en même temps sur plusieurs threads...");
+    for(unsigned i = 0; i < NB_PARALLEL_BALE; i++) {
+        snprintf(file, sizeof(file), "test/ressource/bale_%u.csv", num_bales[i]);
+        elections.bales[i] = csvToBale(file);
+        elections.is_bale_judgment[i] = num_bales[i] == 12;
+        serial[i] = theWinnerMajorityJudgment(elections.bales[i], elections.is_bale_judgment[i]);
+    }
+
+    for(unsigned r = 0; r < 10 && ok; r++) {
+        parallelRun(majorityJudgmentThread, NB_PARALLEL_BALE, &elections);
+        for(unsigned i = 0; i < NB_PARALLEL_BALE; i++) {
+            if(ok && !sameWinners(serial[i], elections.results[i])) ok = echecTest("résultat différent du calcul séquentiel");
+            while(!genListEmpty(elections.results[i]))
+                free(genListPop(elections.results[i]));
+            deleteGenList(&elections.results[i]);
+        }
+    }
+
+    for(unsigned i = 0; i < NB_PARALLEL_BALE; i++) {
+        deleteBale(&elections.bales[i]);
+        while(!genListEmpty(serial[i]))
+            free(genListPop(serial[i]));
+        deleteGenList(&serial[i]);
+    }
+    if(!ok) return false;
+    printsb("\n\t- test passé\n");
+
+    return true;
+}
+
+
+
+
 void test_fun(bool(*f)(), int fnb, char* fname) {
     beforeEach();
     bool test_success = f();
@@ -183,6 +416,10 @@ int main() {
     beforeAll();
 
     test_fun(testTheWinnerMajorityJudgment, 1, "testTheWinnerMajorityJudgment");
+    test_fun(testMajorityJudgmentWeights, 2, "testMajorityJudgmentWeights");
+    test_fun(testMajorityJudgmentParallel, 4, "testMajorityJudgmentParallel");
+    test_fun(testMajorityJudgmentExactTies, 8, "testMajorityJudgmentExactTies");
+    test_fun(testMajorityJudgmentSparseGrades, 16, "testMajorityJudgmentSparseGrades");
 
     
     afterAll();
@@ -121,14 +121,23 @@ bool verifResultSingleTwo(GenList* result, unsigned num_test) {
 
 
 
-bool testOneRoundOnBale(char* file, unsigned num_test) {
+/* nombre de threads des décomptes, 0 pour le choix automatique */
+unsigned nb_threads_test = 0;
+
+bool testOneRoundOnBale(char* file, unsigned num_test, bool compact) {
     GenList* lwinner;
     Bale* bale;
     printsb("\t- chargement ballot\n");
     bale = csvToBale(file);
+    if(compact) {
+        /* mêmes résultats attendus avec les ballots identiques regroupés */
+        Bale* weighted = baleCompact(bale);
+        deleteBale(&bale);
+        bale = weighted;
+    }
 
     printsb("\t- calcul\n");
-    lwinner = theWinnerOneRound(bale);
+    lwinner = nb_threads_test == 0 ? theWinnerOneRound(bale) : theWinnerOneRoundParallel(bale, nb_threads_test);
     if(!lwinner) return echecTest("pointeur null\n");
     if(!verifResultSingleOne(lwinner, num_test)) {
         printl("\n\n<+>---------------------------- [ %s ] :\n\n", file);
@@ -153,31 +162,31 @@ bool testTheWinnerOneRound() {
 
 
     printsb("\ntest sur ballot 3...");
-    if(!testOneRoundOnBale("test/ressource/bale_3.csv", 3)) return false;
+    if(!testOneRoundOnBale("test/ressource/bale_3.csv", 3, false) || !testOneRoundOnBale("test/ressource/bale_3.csv", 3, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur ballot 4...");
-    if(!testOneRoundOnBale("test/ressource/bale_4.csv", 4)) return false;
+    if(!testOneRoundOnBale("test/ressource/bale_4.csv", 4, false) || !testOneRoundOnBale("test/ressource/bale_4.csv", 4, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur ballot 5...");
-    if(!testOneRoundOnBale("test/ressource/bale_5.csv", 5)) return false;
+    if(!testOneRoundOnBale("test/ressource/bale_5.csv", 5, false) || !testOneRoundOnBale("test/ressource/bale_5.csv", 5, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur ballot 6...");
-    if(!testOneRoundOnBale("test/ressource/bale_6.csv", 6)) return false;
+    if(!testOneRoundOnBale("test/ressource/bale_6.csv", 6, false) || !testOneRoundOnBale("test/ressource/bale_6.csv", 6, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur ballot 7...");
-    if(!testOneRoundOnBale("test/ressource/bale_7.csv", 7)) return false;
+    if(!testOneRoundOnBale("test/ressource/bale_7.csv", 7, false) || !testOneRoundOnBale("test/ressource/bale_7.csv", 7, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur ballot 9...");
-    if(!testOneRoundOnBale("test/ressource/bale_9.csv", 9)) return false;
+    if(!testOneRoundOnBale("test/ressource/bale_9.csv", 9, false) || !testOneRoundOnBale("test/ressource/bale_9.csv", 9, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur ballot 10...");
-    if(!testOneRoundOnBale("test/ressource/bale_10.csv", 10)) return false;
+    if(!testOneRoundOnBale("test/ressource/bale_10.csv", 10, false) || !testOneRoundOnBale("test/ressource/bale_10.csv", 10, true)) return false;
     printsb( "\n\t- test passé\n");
 
     return true;
@@ -186,17 +195,23 @@ bool testTheWinnerOneRound() {
 
 
 
-bool testTwoRoundsOnBale(char* file, unsigned num_test) {
+bool testTwoRoundsOnBale(char* file, unsigned num_test, bool compact) {
     GenList* lwinner;
     Bale* bale;
 
     /* chargement du CSV */
     printsb("\t- chargement ballot\n");
     bale = csvToBale(file);
+    if(compact) {
+        /* mêmes résultats attendus avec les ballots identiques regroupés */
+        Bale* weighted = baleCompact(bale);
+        deleteBale(&bale);
+        bale = weighted;
+    }
     
     /* calcul des cainqueurs */
     printsb("\t- calcul\n");
-    lwinner = theWinnerTwoRounds(bale);
+    lwinner = nb_threads_test == 0 ? theWinnerTwoRounds(bale) : theWinnerTwoRoundsParallel(bale, nb_threads_test);
     if(!lwinner) return echecTest("pointeur null\n");
     if(genListSize(lwinner) == 0) return echecTest("Aucun gagnant\n");
     if(!verifResultSingleTwo(lwinner, num_test)) {
@@ -222,31 +237,31 @@ bool testTwoRoundsOnBale(char* file, unsigned num_test) {
 bool testTheWinnerTwoRounds() {
 
     printsb("\ntest sur ballot 3...");
-    if(!testTwoRoundsOnBale("test/ressource/bale_3.csv", 3)) return false;
+    if(!testTwoRoundsOnBale("test/ressource/bale_3.csv", 3, false) || !testTwoRoundsOnBale("test/ressource/bale_3.csv", 3, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur ballot 4...");
-    if(!testTwoRoundsOnBale("test/ressource/bale_4.csv", 4)) return false;
+    if(!testTwoRoundsOnBale("test/ressource/bale_4.csv", 4, false) || !testTwoRoundsOnBale("test/ressource/bale_4.csv", 4, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur ballot 5...");
-    if(!testTwoRoundsOnBale("test/ressource/bale_5.csv", 5)) return false;
+    if(!testTwoRoundsOnBale("test/ressource/bale_5.csv", 5, false) || !testTwoRoundsOnBale("test/ressource/bale_5.csv", 5, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur ballot 6...");
-    if(!testTwoRoundsOnBale("test/ressource/bale_6.csv", 6)) return false;
+    if(!testTwoRoundsOnBale("test/ressource/bale_6.csv", 6, false) || !testTwoRoundsOnBale("test/ressource/bale_6.csv", 6, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur ballot 7...");
-    if(!testTwoRoundsOnBale("test/ressource/bale_7.csv", 7)) return false;
+    if(!testTwoRoundsOnBale("test/ressource/bale_7.csv", 7, false) || !testTwoRoundsOnBale("test/ressource/bale_7.csv", 7, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur ballot 9...");
-    if(!testTwoRoundsOnBale("test/ressource/bale_9.csv", 9)) return false;
+    if(!testTwoRoundsOnBale("test/ressource/bale_9.csv", 9, false) || !testTwoRoundsOnBale("test/ressource/bale_9.csv", 9, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb("\ntest sur ballot 10...");
-    if(!testTwoRoundsOnBale("test/ressource/bale_10.csv", 10)) return false;
+    if(!testTwoRoundsOnBale("test/ressource/bale_10.csv", 10, false) || !testTwoRoundsOnBale("test/ressource/bale_10.csv", 10, true)) return false;
     printsb( "\n\t- test passé\n");
 
     return true;
@@ -258,6 +273,76 @@ bool testTheWinnerTwoRounds() {
 
 
 
+bool testTwoRoundsCsvOnFile(char* file) {
+    GenList *lwinner, *lcsv;
+    WinnerSingleTwo *w, *wc;
+    unsigned nb_voters, nb_candidats;
+    bool ok = true;
+
+    /* même résultat que sur le ballot construit (résumé des duels ou nouvelle lecture) */
+    Bale* bale = csvToBale(file);
+    lwinner = theWinnerTwoRounds(bale);
+    lcsv = theWinnerTwoRoundsCsv(file, &nb_voters, &nb_candidats);
+
+    if(nb_voters != baleNbVoter(bale) || nb_candidats != baleNbCandidat(bale))
+        ok = echecTest("dimensions différentes");
+    if(ok && genListSize(lwinner) != genListSize(lcsv)) ok = echecTest("nombre de gagnants différent");
+    for(unsigned i = 0; ok && i < genListSize(lwinner); i++) {
+        w = genListGet(lwinner, i);
+        wc = genListGet(lcsv, i);
+        if(strcmp(w->name, wc->name) != 0 || w->score != wc->score || w->round != wc->round)
+            ok = echecTest("gagnant différent");
+    }
+    if(!ok) {
+        printsb("\n\t- fichier ");
+        printsb(file);
+    }
+
+    deleteBale(&bale);
+    while(!genListEmpty(lwinner))
+        free(genListPop(lwinner));
+    deleteGenList(&lwinner);
+    while(!genListEmpty(lcsv))
+        free(genListPop(lcsv));
+    deleteGenList(&lcsv);
+    return ok;
+}
+
+bool testTwoRoundsCsv() {
+    char file[64];
+
+    printsb("\ntest décompte lu directement dans le csv...");
+    for(unsigned i = 1; i <= 13; i++) {
+        snprintf(file, sizeof(file), "test/ressource/bale_%u.csv", i);
+        if(!testTwoRoundsCsvOnFile(file)) return false;
+    }
+    if(!testTwoRoundsCsvOnFile("test/ressource/unit/bale_wide.csv")) return false;
+    printsb("\n\t- test passé\n");
+
+    return true;
+}
+
+bool testSingleMemberParallel() {
+    unsigned nb_threads[] = {1, 2, 3, 5};
+    bool ok = true;
+
+    /* décomptes répartis : mêmes résultats, y compris avec plus de threads que de lignes
+     * (le string builder est vidé avant chaque série pour ne garder que la série en échec) */
+    for(unsigned i = 0; i < 4 && ok; i++) {
+        nb_threads_test = nb_threads[i];
+        beforeEach();
+        ok = testTheWinnerOneRound();
+        if(ok) {
+            beforeEach();
+            ok = testTheWinnerTwoRounds();
+        }
+    }
+    nb_threads_test = 0;
+
+    return ok;
+}
+
+
 void test_fun(bool(*f)(), int fnb, char* fname) {
     beforeEach();
     bool test_success = f();
@@ -275,6 +360,8 @@ int main() {
 
     test_fun(testTheWinnerOneRound, 1, "testTheWinnerOneRound");
     test_fun(testTheWinnerTwoRounds, 1, "testTheWinnerTwoRounds");
+    test_fun(testSingleMemberParallel, 2, "testSingleMemberParallel");
+    test_fun(testTwoRoundsCsv, 4, "testTwoRoundsCsv");
 
     
     afterAll();
@@ -192,14 +192,13 @@ bool testBaleSet() {
 bool checkLabels(unsigned id_label) {
     GenList* labels;
     Bale* b;
-    char* candidat_label;
+    const char* candidat_label;
     labels = loadLabelsInList(id_label);
     if(!labels) return echecTest("\n X-- Erreur chargement labels");
     b = createBale(NB_VOTER, NB_CANDIDAT, labels);
     for(unsigned i = 0; i < NB_CANDIDAT; i++) {
         candidat_label = baleColumnToLabel(b, i);
         if(strcmp(candidat_label, genListGet(labels, i)) != 0) return echecTest("\n X-- labels différents");
-        free(candidat_label);
     }
     deleteGenList(&labels);
     deleteBale(&b);
@@ -218,6 +217,188 @@ bool testBaleColumnToLabel() {
     return true;
 }
 
+bool testBaleCompact() {
+    GenList* labels;
+    Bale *b, *compact, *weighted, *compact2;
+    bool ok = true;
+
+    /* NB_VOTER votants, 3 ballots distincts (ligne l identique à la ligne l%3) */
+    printsb( "\ntest compactage des ballots identiques ...");
+    labels = loadLabelsInList(1);
+    b = createBale(NB_VOTER, NB_CANDIDAT, labels);
+    for(unsigned l = 0; l < NB_VOTER; l++)
+        for(unsigned c = 0; c < NB_CANDIDAT; c++)
+            baleSetValue(b, l, c, (l % 3) * NB_CANDIDAT + c);
+    compact = baleCompact(b);
+    if(baleNbLine(compact) != 3) ok = echecTest("\n X-- erreur nombre lignes");
+    if(baleNbVoter(compact) != NB_VOTER) ok = echecTest("\n X-- erreur nombre votants");
+    if(baleNbCandidat(compact) != NB_CANDIDAT) ok = echecTest("\n X-- erreur nombre candidats");
+    for(unsigned l = 0; l < 3 && ok; l++) {
+        if(baleLineWeight(compact, l) != (NB_VOTER - l + 2) / 3) ok = echecTest("\n X-- poids incorrect");
+        for(unsigned c = 0; c < NB_CANDIDAT && ok; c++)
+            if(baleGetValue(compact, l, c) != (int)(l * NB_CANDIDAT + c)) ok = echecTest("\n X-- valeur incorrecte");
+    }
+    if(ok) printsb( "\n\t- test passé\n");
+
+    /* les poids d'un ballot déjà pondéré s'additionnent (lignes 0 et 2 identiques) */
+    printsb( "\ntest compactage d'un ballot pondéré ...");
+    weighted = createBale(3, NB_CANDIDAT, labels);
+    for(unsigned l = 0; l < 3; l++) {
+        baleSetLineWeight(weighted, l, 2 + 3 * l);
+        for(unsigned c = 0; c < NB_CANDIDAT; c++)
+            baleSetValue(weighted, l, c, (l % 2) * NB_CANDIDAT + c);
+    }
+    compact2 = baleCompact(weighted);
+    if(ok && (baleNbLine(compact2) != 2 || baleNbVoter(compact2) != 15)) ok = echecTest("\n X-- erreur dimensions");
+    if(ok && (baleLineWeight(compact2, 0) != 10 || baleLineWeight(compact2, 1) != 5)) ok = echecTest("\n X-- poids incorrect");
+    if(ok) printsb( "\n\t- test passé\n");
+
+    deleteBale(&compact2);
+    deleteBale(&weighted);
+    deleteBale(&compact);
+    deleteBale(&b);
+    deleteGenList(&labels);
+    return ok;
+}
+
+bool checkCellSize(unsigned nbc, unsigned cell_size, int max) {
+    GenList* labels = createGenList(nbc);
+    char* label;
+    int line[nbc];
+    bool ok = true;
+    Bale* b;
+
+    for(unsigned c = 0; c < nbc; c++) {
+        label = malloc(sizeof(char)*MAX_LENGHT_LABEL);
+        snprintf(label, MAX_LENGHT_LABEL, "candidat %u", c);
+        genListAdd(labels, label);
+    }
+    b = createBale(3, nbc, labels);
+    if(baleCellSize(b) != cell_size) ok = echecTest("\n X-- mauvaise taille de case");
+
+    /* valeurs extrêmes, -1 et case non remplie (DEFAULT_VALUE) relues à l'identique */
+    for(unsigned c = 0; c + 1 < nbc; c++) {
+        baleSetValue(b, 0, c, c % 2 ? max : -max - 1);
+        baleSetValue(b, 1, c, c % 2 ? -1 : (int)c);
+    }
+    for(unsigned l = 0; l < 3 && ok; l++) {
+        baleGetLine(b, l, line);
+        for(unsigned c = 0; c < nbc && ok; c++) {
+            int v = c + 1 == nbc || l == 2 ? DEFAULT_VALUE : l == 0 ? (c % 2 ? max : -max - 1) : (c % 2 ? -1 : (int)c);
+            if(baleGetValue(b, l, c) != v || line[c] != v) ok = echecTest("\n X-- valeur incorrecte");
+        }
+    }
+
+    deleteBale(&b);
+    while(!genListEmpty(labels))
+        free(genListPop(labels));
+    deleteGenList(&labels);
+    return ok;
+}
+
+bool testBaleCellSize() {
+    printsb( "\ntest cases sur 8 bits ...");
+    if(!checkCellSize(NB_CANDIDAT, 1, 127)) return false;
+    if(!checkCellSize(126, 1, 127)) return false;
+    printsb( "\n\t- test passé\n");
+
+    printsb( "\ntest cases sur 16 bits ...");
+    if(!checkCellSize(127, 2, 32767)) return false;
+    if(!checkCellSize(1000, 2, 32767)) return false;
+    printsb( "\n\t- test passé\n");
+
+    printsb( "\ntest élargissement des cases par une valeur inattendue ...");
+    GenList* labels = loadLabelsInList(1);
+    Bale* b = createBale(3, NB_LABELS, labels);
+    Bale* compact;
+    int values[] = {3, 200, -1, 70000, -40000};
+    unsigned cell_sizes[] = {1, 2, 2, 4, 4};
+    for(unsigned i = 0; i < 5; i++) {
+        baleSetValue(b, i % 3, i, values[i]);
+        if(baleCellSize(b) != cell_sizes[i]) return echecTest("\n X-- mauvaise taille de case");
+        for(unsigned k = 0; k <= i; k++)
+            if(baleGetValue(b, k % 3, k) != values[k]) return echecTest("\n X-- valeur perdue");
+    }
+    if(baleGetValue(b, 2, NB_LABELS - 1) != DEFAULT_VALUE) return echecTest("\n X-- case non remplie modifiée");
+    compact = baleCompact(b);
+    if(baleCellSize(compact) != 4 || baleGetValue(compact, 1, 1) != 200) return echecTest("\n X-- ballot compacté incorrect");
+    deleteBale(&compact);
+    deleteBale(&b);
+    deleteGenList(&labels);
+    printsb( "\n\t- test passé\n");
+
+    return true;
+}
+
+
+bool checkFirstChoices(unsigned nbl, unsigned nbc) {
+    GenList* labels = createGenList(nbc);
+    GenList* min;
+    char* label;
+    unsigned count[nbc], ref[nbc];
+    unsigned l_begin = nbl / 3;
+    bool ok = true;
+    Bale* b;
+
+    for(unsigned c = 0; c < nbc; c++) {
+        label = malloc(sizeof(char)*MAX_LENGHT_LABEL);
+        snprintf(label, MAX_LENGHT_LABEL, "candidat %u", c);
+        genListAdd(labels, label);
+    }
+    b = createBale(nbl, nbc, labels);
+
+    /* quelques rangs positifs ou nuls par ligne (égalités fréquentes), le reste non classé
+     * (-1) ou vide (DEFAULT_VALUE), poids variés */
+    srand(nbc);
+    for(unsigned l = 0; l < nbl; l++) {
+        baleSetLineWeight(b, l, 1 + l % 4);
+        for(unsigned c = 0; c < nbc; c++) {
+            if(rand() % nbc < 3) baleSetValue(b, l, c, rand() % 3);
+            else if(rand() % 2) baleSetValue(b, l, c, -1);
+        }
+    }
+
+    /* référence : un baleMin par ligne */
+    memset(ref, 0, sizeof(ref));
+    for(unsigned l = l_begin; l < nbl; l++) {
+        min = baleMin(b, l, -1);
+        if(genListSize(min) == 1)
+            ref[((int*)genListGet(min, 0))[2]] += baleLineWeight(b, l);
+        while(!genListEmpty(min))
+            free(genListPop(min));
+        deleteGenList(&min);
+    }
+
+    /* les compteurs sont incrémentés, pas remis à zéro */
+    memset(count, 0, sizeof(count));
+    baleCountFirstChoices(b, l_begin, l_begin, count);
+    baleCountFirstChoices(b, l_begin, nbl, count);
+    for(unsigned c = 0; c < nbc && ok; c++)
+        if(count[c] != ref[c]) ok = echecTest("\n X-- mauvais décompte");
+
+    deleteBale(&b);
+    while(!genListEmpty(labels))
+        free(genListPop(labels));
+    deleteGenList(&labels);
+    return ok;
+}
+
+bool testBaleCountFirstChoices() {
+    printsb( "\ntest premiers choix, cases sur 8 bits ...");
+    if(!checkFirstChoices(3000, 5)) return false;
+    printsb( "\n\t- test passé\n");
+
+    printsb( "\ntest premiers choix, cases sur 16 bits ...");
+    if(!checkFirstChoices(300, 200)) return false;
+    printsb( "\n\t- test passé\n");
+
+    printsb( "\ntest premiers choix, cases sur 32 bits ...");
+    if(!checkFirstChoices(30, 40000)) return false;
+    printsb( "\n\t- test passé\n");
+
+    return true;
+}
+
 
 void test_fun(bool(*f)(), int fnb, char* fname) {
     beforeEach();
@@ -237,6 +418,9 @@ int main() {
     test_fun(testCreateBale, 1, "testCreateBale");
     test_fun(testBaleSet, 2, "testBaleSet");
     test_fun(testBaleColumnToLabel, 4, "testBaleColumnToLabel");
+    test_fun(testBaleCompact, 8, "testBaleCompact");
+    test_fun(testBaleCellSize, 16, "testBaleCellSize");
+    test_fun(testBaleCountFirstChoices, 32, "testBaleCountFirstChoices");
 
 
     afterAll();
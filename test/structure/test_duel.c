@@ -146,7 +146,7 @@ bool testDuelSetValue() {
 bool checkLabels(unsigned id_label) {
     Duel *d;
     GenList* labels;
-    char* candidat_label;
+    const char* candidat_label;
     labels = loadLabelsInList(id_label);
 
     if(!labels) return echecTest("Erreur chargement labels");
@@ -154,7 +154,6 @@ bool checkLabels(unsigned id_label) {
     for(unsigned i = 0; i < NB_CANDIDAT; i++) {
         candidat_label = duelIndexToLabel(d, i);
         if(strcmp(candidat_label, genListGet(labels, i)) != 0) return echecTest("\n X-- labels différents");
-        free(candidat_label);
     }
     deleteGenList(&labels);
     deleteDuel(&d);
@@ -175,22 +174,29 @@ bool testDuelIndexToLabel() {
 
 
 
-bool convertionBaleToDuel(char* path_bale, char* path_duel_ref) {
+bool convertionBaleToDuel(char* path_bale, char* path_duel_ref, unsigned nb_threads, bool compact) {
     Duel* d_ref, *d_frome_b;
     Bale* b;
     unsigned nb_candidats;
-    char* label, *label_ref;
+    const char* label, *label_ref;
 
     /* chargment de la donnée */
     b = csvToBale(path_bale);
     if(!b) return echecTest("Echec chargement bale 8");
+    if(compact) {
+        /* ballots identiques regroupés : même matrice de duels attendue */
+        Bale* weighted = baleCompact(b);
+        deleteBale(&b);
+        b = weighted;
+    }
     d_ref = csvToDuel(path_duel_ref);
     if(!d_ref) return echecTest("Echec chargement duel of bale 8");
     printsb("\n chargement de la donnée réussi...");
 
     /* convertion bale to duel */
-    d_frome_b = duelFromBale(b);
+    d_frome_b = nb_threads == 0 ? duelFromBale(b) : duelFromBaleParallel(b, nb_threads);
     if(!d_frome_b) return echecTest("Pointeur null");
+    if(duelLabels(d_frome_b) != baleLabels(b)) return echecTest("labels copiés au lieu d'être partagés");
     
     /* test nouveau duel */
     nb_candidats = duelNbCandidat(d_frome_b);
@@ -200,8 +206,6 @@ bool convertionBaleToDuel(char* path_bale, char* path_duel_ref) {
         label_ref = duelIndexToLabel(d_ref, l);
         label = duelIndexToLabel(d_frome_b, l);
         if(strcmp(label, label_ref) != 0) return echecTest("label différent");
-        free(label);
-        free(label_ref);
 
         /* test valeurs */
         for(unsigned c = 0; c < nb_candidats; c++) {
@@ -224,13 +228,68 @@ bool testDuelFromBale () {
     
 
     printsb( "\ntest sur bale  8...");
-    if(!convertionBaleToDuel("test/ressource/bale_8.csv", "test/ressource/duel_of_bale_8.csv")) return false;
+    if(!convertionBaleToDuel("test/ressource/bale_8.csv", "test/ressource/duel_of_bale_8.csv", 0, false) || !convertionBaleToDuel("test/ressource/bale_8.csv", "test/ressource/duel_of_bale_8.csv", 0, true)) return false;
     printsb( "\n\t- test passé\n");
 
     printsb( "\ntest sur bale  9...");
-    if(!convertionBaleToDuel("test/ressource/bale_9.csv", "test/ressource/duel_of_bale_9.csv")) return false;
+    if(!convertionBaleToDuel("test/ressource/bale_9.csv", "test/ressource/duel_of_bale_9.csv", 0, false) || !convertionBaleToDuel("test/ressource/bale_9.csv", "test/ressource/duel_of_bale_9.csv", 0, true)) return false;
+    printsb( "\n\t- test passé\n");
+
+    return true;
+
+}
+
+
+
+bool testDuelAddBallot() {
+    /* égalités, non classés (-1) et case vide (DEFAULT_VALUE) */
+    int ballots[4][NB_CANDIDAT] = {{2, -1, 2, 1, -1}, {-1, -1, -1, -1, -1}, {1, 2, 3, 4, 5}, {3, DEFAULT_VALUE, -1, 3, 1}};
+    int ref[NB_CANDIDAT][NB_CANDIDAT] = {{0}};
+    int x, y;
+
+    GenList *labels = loadLabelsInList(1);
+    LabelTable *table = createLabelTable(labels);
+    Duel *d = createEmptyDuel(NB_CANDIDAT, table);
+    deleteLabelTable(&table);
+    deleteGenList(&labels);
+
+    /* scores attendus : x bat y si x est classé et (y non classé ou rang x < rang y),
+     * le ballot b compte pour b+1 votants */
+    for(unsigned b = 0; b < 4; b++) {
+        duelAddBallot(d, ballots[b], b + 1);
+        for(unsigned i = 0; i < NB_CANDIDAT; i++)
+            for(unsigned j = 0; j < NB_CANDIDAT; j++) {
+                x = ballots[b][i];
+                y = ballots[b][j];
+                if(x != -1 && x != y && (y == -1 || x < y)) ref[i][j] += b + 1;
+            }
+    }
+
+    printsb( "\ntest sur 4 votants...");
+    for(unsigned i = 0; i < NB_CANDIDAT; i++)
+        for(unsigned j = 0; j < NB_CANDIDAT; j++)
+            if(duelGetValue(d, i, j) != ref[i][j]) {
+                deleteDuel(&d);
+                return echecTest("Valeur différente");
+            }
     printsb( "\n\t- test passé\n");
 
+    deleteDuel(&d);
+    return true;
+}
+
+
+bool testDuelFromBaleParallel () {
+    unsigned nb_threads[] = {1, 2, 3, 16};
+
+    for(unsigned i = 0; i < 4; i++) {
+        printsb( "\ntest sur bale  8...");
+        if(!convertionBaleToDuel("test/ressource/bale_8.csv", "test/ressource/duel_of_bale_8.csv", nb_threads[i], false) || !convertionBaleToDuel("test/ressource/bale_8.csv", "test/ressource/duel_of_bale_8.csv", nb_threads[i], true)) return false;
+
+        printsb( "\ntest sur bale  9...");
+        if(!convertionBaleToDuel("test/ressource/bale_9.csv", "test/ressource/duel_of_bale_9.csv", nb_threads[i], false) || !convertionBaleToDuel("test/ressource/bale_9.csv", "test/ressource/duel_of_bale_9.csv", nb_threads[i], true)) return false;
+    }
+
     return true;
 
 }
@@ -255,7 +314,9 @@ int main() {
     test_fun(testCreateDuel, 1, "testCreateDuel");
     test_fun(testDuelSetValue, 2, "testDuelSetValue");
     test_fun(testDuelIndexToLabel, 8, "testDuelIndexToLabel");
+    test_fun(testDuelAddBallot, 4, "testDuelAddBallot");
     test_fun(testDuelFromBale, 8, "testDuelFromBale");
+    test_fun(testDuelFromBaleParallel, 16, "testDuelFromBaleParallel");
 
 
 
@@ -387,6 +387,53 @@ bool testGenListIte() {
 }
 
 
+bool testGenListCapacity() {
+    GenList* l;
+    unsigned capacity;
+
+    /* la capacité ne diminue pas lors des suppressions */
+    printsb( "\ntest capacité après pop/remove...");
+    l = createUniqueGenList(LIST_SIZE);
+    capacity = genListCapacity(l);
+    if(capacity < LIST_SIZE) return echecTest(" X-- capacité < taille");
+    genListRemove(l, 0);
+    while(!genListEmpty(l)) genListPop(l);
+    if(genListCapacity(l) != capacity) return echecTest(" X-- capacité réduite");
+    printsb("\n\t-test passé\n");
+
+    /* réduction explicite */
+    printsb( "\ntest genListShrinkToFit...");
+    genListAdd(l, (void*)0);
+    genListShrinkToFit(l);
+    if(genListCapacity(l) != 1) return echecTest(" X-- capacité != taille");
+    if(!testUniqueGenList(l, 1)) return false;
+    printsb("\n\t-test passé\n");
+
+    /* réservation : jamais de réduction, valeurs conservées */
+    printsb( "\ntest genListReserve...");
+    genListReserve(l, LIST_SIZE);
+    if(genListCapacity(l) != LIST_SIZE) return echecTest(" X-- capacité != LIST_SIZE");
+    genListReserve(l, 2);
+    if(genListCapacity(l) != LIST_SIZE) return echecTest(" X-- capacité réduite");
+    for(unsigned long i = 1; i < LIST_SIZE; i++)
+        genListAdd(l, (void*)i);
+    if(genListCapacity(l) != LIST_SIZE) return echecTest(" X-- agrandissement inutile");
+    if(!testUniqueGenList(l, LIST_SIZE)) return false;
+    printsb("\n\t-test passé\n");
+
+    /* croissance géométrique depuis une liste vide */
+    printsb( "\ntest croissance géométrique...");
+    genListShrinkToFit(l);
+    genListAdd(l, (void*)LIST_SIZE);
+    if(genListCapacity(l) < 2 * LIST_SIZE) return echecTest(" X-- capacité non doublée");
+    if(!testUniqueGenList(l, LIST_SIZE + 1)) return false;
+    deleteGenList(&l);
+    printsb("\n\t-test passé\n");
+
+    return true;
+}
+
+
 
 void test_fun(bool(*f)(), int fnb, char* fname) {
     beforeEach();
@@ -412,6 +459,7 @@ int main() {
     test_fun(testGenListEmpty, 64, "testGenListEmpty");
     test_fun(testGenListCopy, 128, "testGenListCopy");
     test_fun(testGenListIte, 129, "testGenListIte");
+    test_fun(testGenListCapacity, 256, "testGenListCapacity");
 
     
 
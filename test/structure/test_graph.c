@@ -0,0 +1,214 @@
+/**
+ * @file test_graph.c
+ * @brief Test sur la structure de données graphe (extraction triée des arcs)
+ *
+ * @remarks Les fonction suivantes ne sont pas explicitement testé mais sont
+ * utilisée dans les tests des autres fonctions :
+ * - createGraph
+ * - deleteGraph
+ * - graphAdd
+ * - graphNbArc
+ */
+
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../src/logger.h"
+#include "../test_utils.h"
+#include "../../src/structure/graph.h"
+#include "label_test_set.h"
+
+/* nombre de sommets du graphe de test */
+#define NB_VERTEX NB_LABELS
+/* nombre d'arcs du graphe de test */
+#define NB_ARC 8
+
+/* arcs du graphe de test {src, dest, poids}, dans l'ordre (src, dest) avec des poids égaux */
+const int arcs_ref[NB_ARC][3] = {
+    {0, 1, 5}, {0, 3, 2}, {1, 2, 5}, {1, 4, 7},
+    {2, 0, 2}, {3, 1, 9}, {3, 4, 5}, {4, 2, 0}
+};
+
+/* indices dans arcs_ref du tri attendu (stable : à poids égal, ordre (src, dest)) */
+const unsigned descending_ref[NB_ARC] = {5, 3, 0, 2, 6, 1, 4, 7};
+const unsigned ascending_ref[NB_ARC] = {7, 1, 4, 0, 2, 6, 3, 5};
+
+
+
+/*
+    ===================
+    === OUTILS TEST ===
+    ===================
+*/
+
+#define printsb(msg) addLineStringBuilder(string_builder, msg)
+
+StringBuilder* string_builder;
+int return_value;
+
+void beforeAll() {
+    init_logger(NULL);
+    string_builder = createStringBuilder();
+    return_value = 0;
+}
+
+void afterAll() {
+    deleteStringBuilder(&string_builder);
+    close_logger();
+}
+
+void beforeEach() {
+    emptyStringBuilder(string_builder);
+}
+
+void afterEach() {
+}
+
+bool echecTest(char* msg) {
+    char buff[256] = "\n X-- ";
+    strncat(buff, msg, 200);
+    printsb(buff);
+    return false;
+}
+
+
+
+/*
+    =====================
+    === OUTILS GRAPHE ===
+    =====================
+*/
+
+/**
+ * @date 16/10/2026
+ * @brief Crée le graphe de test à partir de arcs_ref (ajoutés dans le désordre)
+ *
+ * @return nouveau graphe
+ */
+Graph* newTestGraph() {
+    GenList *labels = loadLabelsInList(1);
+    Graph *g = createGraph(NB_VERTEX, labels);
+    deleteGenList(&labels);
+    for(int i = NB_ARC - 1; i >= 0; i--)
+        graphAdd(g, arcs_ref[i][0], arcs_ref[i][1], arcs_ref[i][2]);
+    return g;
+}
+
+/**
+ * @date 16/10/2026
+ * @brief Test si l'arc correspond à l'arc d'indice id de arcs_ref
+ */
+bool sameArc(Arc *arc, unsigned id) {
+    return (int)arc->id_src == arcs_ref[id][0] && (int)arc->id_dest == arcs_ref[id][1]
+        && arc->weight == arcs_ref[id][2];
+}
+
+
+
+/*
+    =============
+    === TESTS ===
+    =============
+*/
+
+bool testGraphToSortedArcs() {
+    Graph *g = newTestGraph();
+    unsigned nb_arcs;
+    Arc *arcs;
+
+    printsb("\ntest ordre décroissant...");
+    arcs = graphToSortedArcs(g, DESCENDING, &nb_arcs);
+    if(nb_arcs != NB_ARC || nb_arcs != graphNbArc(g)) return echecTest("mauvais nombre d'arcs");
+    for(unsigned i = 0; i < NB_ARC; i++)
+        if(!sameArc(&arcs[i], descending_ref[i])) return echecTest("mauvais ordre");
+    free(arcs);
+    printsb("\n\t- test passé\n");
+
+    printsb("\ntest ordre croissant...");
+    arcs = graphToSortedArcs(g, ASCENDING, &nb_arcs);
+    if(nb_arcs != NB_ARC) return echecTest("mauvais nombre d'arcs");
+    for(unsigned i = 0; i < NB_ARC; i++)
+        if(!sameArc(&arcs[i], ascending_ref[i])) return echecTest("mauvais ordre");
+    free(arcs);
+    printsb("\n\t- test passé\n");
+
+    deleteGraph(&g);
+    return true;
+}
+
+bool testGraphToSortedList() {
+    Graph *g = newTestGraph();
+    GenList *l;
+    bool ok;
+    int order[2] = {DESCENDING, ASCENDING};
+    const unsigned *ref[2] = {descending_ref, ascending_ref};
+
+    for(unsigned o = 0; o < 2; o++) {
+        printsb(o == 0 ? "\ntest ordre décroissant..." : "\ntest ordre croissant...");
+        l = graphToSortedList(g, order[o]);
+        ok = genListSize(l) == NB_ARC;
+        for(unsigned i = 0; i < NB_ARC && ok; i++)
+            ok = sameArc((Arc*)genListGet(l, i), ref[o][i]);
+        while(!genListEmpty(l))
+            free(genListPop(l));
+        deleteGenList(&l);
+        if(!ok) return echecTest("mauvaise liste triée");
+        printsb("\n\t- test passé\n");
+    }
+
+    deleteGraph(&g);
+    return true;
+}
+
+bool testSortArcs() {
+    unsigned nb_arcs = 1000;
+    Arc *arcs = malloc(nb_arcs * sizeof(Arc));
+    bool ok = true;
+
+    printsb("\ntest tri stable de 1000 arcs...");
+    srand(7);
+    for(unsigned i = 0; i < nb_arcs; i++) {
+        arcs[i].id_src = i;     /* position d'origine, pour vérifier la stabilité */
+        arcs[i].id_dest = 0;
+        arcs[i].weight = rand() % 50;
+    }
+    sortArcs(arcs, nb_arcs, DESCENDING);
+    for(unsigned i = 1; i < nb_arcs && ok; i++)
+        ok = arcs[i - 1].weight > arcs[i].weight
+            || (arcs[i - 1].weight == arcs[i].weight && arcs[i - 1].id_src < arcs[i].id_src);
+    free(arcs);
+    if(!ok) return echecTest("tri incorrect ou instable");
+    printsb("\n\t- test passé\n");
+
+    return true;
+}
+
+
+
+
+void test_fun(bool(*f)(), int fnb, char* fname) {
+    beforeEach();
+    bool test_success = f();
+    afterEach();
+    if (!test_success) {
+        return_value += fnb;
+        printFailure(fname);
+        printStringBuilder(string_builder);
+    } else printSuccess(fname);
+}
+
+
+int main() {
+    beforeAll();
+
+    test_fun(testGraphToSortedArcs, 1, "testGraphToSortedArcs");
+    test_fun(testGraphToSortedList, 2, "testGraphToSortedList");
+    test_fun(testSortArcs, 4, "testSortArcs");
+
+    afterAll();
+
+    return return_value;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file test_label_table.c
+ * @brief Test sur la table de labels partagée
+ *
+ * @remarks Les fonction suivantes ne sont pas explicitement testé mais sont
+ * utilisée dans les tests des autres fonctions :
+ * - createLabelTable
+ * - deleteLabelTable
+ * - labelTableSize
+ */
+
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../src/logger.h"
+#include "../test_utils.h"
+#include "../../src/structure/label_table.h"
+#include "../../src/structure/bale.h"
+#include "../../src/structure/duel.h"
+#include "../../src/structure/graph.h"
+#include "label_test_set.h"
+
+
+
+/*
+    ===================
+    === OUTILS TEST ===
+    ===================
+*/
+
+#define printsb(msg) addLineStringBuilder(string_builder, msg)
+
+StringBuilder* string_builder;
+int return_value;
+
+void beforeAll() {
+    init_logger(NULL);
+    string_builder = createStringBuilder();
+    return_value = 0;
+}
+
+void afterAll() {
+    deleteStringBuilder(&string_builder);
+    close_logger();
+}
+
+void beforeEach() {
+    emptyStringBuilder(string_builder);
+}
+
+void afterEach() {
+}
+
+bool echecTest(char* msg) {
+    char buff[256] = "\n X-- ";
+    strncat(buff, msg, 200);
+    printsb(buff);
+    return false;
+}
+
+
+
+/*
+    =============
+    === TESTS ===
+    =============
+*/
+
+bool testLabelTableGet() {
+    GenList *labels;
+    LabelTable *t;
+
+    printsb("\ntest labels identiques à la liste...");
+    for(unsigned id = 1; id <= 5; id++) {
+        labels = loadLabelsInList(id);
+        t = createLabelTable(labels);
+        if(labelTableSize(t) != NB_LABELS) return echecTest("mauvais nombre de labels");
+        for(unsigned i = 0; i < NB_LABELS; i++) {
+            if(strcmp(labelTableGet(t, i), genListGet(labels, i)) != 0) return echecTest("labels différents");
+            /* les labels sont copiés dans la table */
+            if(labelTableGet(t, i) == genListGet(labels, i)) return echecTest("label non copié");
+        }
+        deleteLabelTable(&t);
+        deleteGenList(&labels);
+    }
+    printsb("\n\t- test passé\n");
+
+    printsb("\ntest label trop long tronqué...");
+    char long_label[MAX_LENGHT_LABEL + 10];
+    memset(long_label, 'X', sizeof(long_label) - 1);
+    long_label[sizeof(long_label) - 1] = '\0';
+    labels = createGenList(1);
+    genListAdd(labels, long_label);
+    t = createLabelTable(labels);
+    if(strlen(labelTableGet(t, 0)) != MAX_LENGHT_LABEL - 1) return echecTest("label non tronqué");
+    deleteLabelTable(&t);
+    deleteGenList(&labels);
+    printsb("\n\t- test passé\n");
+
+    return true;
+}
+
+bool testLabelTableSearch() {
+    GenList *labels = loadLabelsInList(5);
+    LabelTable *t = createLabelTable(labels);
+
+    printsb("\ntest recherche...");
+    for(unsigned i = 0; i < NB_LABELS; i++)
+        if(labelTableSearch(t, genListGet(labels, i)) != (int)i) return echecTest("label introuvable");
+    if(labelTableSearch(t, "absent") != -1) return echecTest("label absent trouvé");
+    printsb("\n\t- test passé\n");
+
+    deleteLabelTable(&t);
+    deleteGenList(&labels);
+    return true;
+}
+
+bool testLabelTableShare() {
+    GenList *labels = loadLabelsInList(2);
+    LabelTable *t = createLabelTable(labels);
+    deleteGenList(&labels);
+
+    printsb("\ntest partage entre ballot, duel et graph...");
+    Bale *b = createBaleFromTable(1, NB_LABELS, t);
+    Bale *cp = baleCopy(b);
+    Duel *d = createEmptyDuel(NB_LABELS, baleLabels(b));
+    Graph *g = createGraphFromTable(NB_LABELS, duelLabels(d));
+    const char *label = labelTableGet(t, 3);
+    deleteLabelTable(&t);
+    if(t != NULL) return echecTest("pointeur non NULL après suppression");
+
+    if(baleLabels(cp) != baleLabels(b) || duelLabels(d) != baleLabels(b)) return echecTest("table copiée");
+    if(baleColumnToLabel(b, 3) != label || duelIndexToLabel(d, 3) != label || graphGetLabel(g, 3) != label)
+        return echecTest("label copié");
+
+    /* la table survit à chaque structure tant qu'une autre la partage */
+    deleteBale(&b);
+    deleteDuel(&d);
+    if(strcmp(graphGetLabel(g, 3), "D") != 0 || strcmp(baleColumnToLabel(cp, 3), "D") != 0)
+        return echecTest("label invalide après suppression");
+    deleteGraph(&g);
+    deleteBale(&cp);
+    printsb("\n\t- test passé\n");
+
+    return true;
+}
+
+
+
+
+void test_fun(bool(*f)(), int fnb, char* fname) {
+    beforeEach();
+    bool test_success = f();
+    afterEach();
+    if (!test_success) {
+        return_value += fnb;
+        printFailure(fname);
+        printStringBuilder(string_builder);
+    } else printSuccess(fname);
+}
+
+
+int main() {
+    beforeAll();
+
+    test_fun(testLabelTableGet, 1, "testLabelTableGet");
+    test_fun(testLabelTableSearch, 2, "testLabelTableSearch");
+    test_fun(testLabelTableShare, 4, "testLabelTableShare");
+
+    afterAll();
+
+    return return_value;
+}
@@ -336,6 +336,83 @@ bool testListCopy() {
 
 
 
+bool testListCapacity() {
+    List* l;
+    unsigned capacity;
+
+    /* la capacité ne diminue pas lors des suppressions */
+    printsb( "\ntest capacité après pop/remove...");
+    l = createUniqueList(LIST_SIZE);
+    capacity = listCapacity(l);
+    if(capacity < LIST_SIZE) return echecTest(" X-- capacité < taille");
+    listRemove(l, 0);
+    while(!listEmpty(l)) listPop(l);
+    if(listCapacity(l) != capacity) return echecTest(" X-- capacité réduite");
+    printsb("\n\t-test passé\n");
+
+    /* réduction explicite puis réservation */
+    printsb( "\ntest listShrinkToFit / listReserve...");
+    listAdd(l, 0);
+    listShrinkToFit(l);
+    if(listCapacity(l) != 1) return echecTest(" X-- capacité != taille");
+    listReserve(l, LIST_SIZE);
+    listReserve(l, 2);
+    if(listCapacity(l) != LIST_SIZE) return echecTest(" X-- capacité != LIST_SIZE");
+    for(unsigned i = 1; i < LIST_SIZE; i++)
+        listAdd(l, i);
+    if(listCapacity(l) != LIST_SIZE) return echecTest(" X-- agrandissement inutile");
+    if(!testUniqueList(l, LIST_SIZE)) return false;
+    deleteList(&l);
+    printsb("\n\t-test passé\n");
+
+    return true;
+}
+
+bool testListBulk() {
+    List* l;
+    int values[LIST_SIZE];
+    int *data;
+
+    /* listFill sur liste vide puis non vide */
+    printsb( "\ntest listFill...");
+    l = createList(0);
+    listFill(l, 7, LIST_SIZE);
+    listFill(l, -1, 3);
+    listFill(l, 5, 0);
+    if(listSize(l) != LIST_SIZE + 3) return echecTest(" X-- erreur taille");
+    for(unsigned i = 0; i < LIST_SIZE + 3; i++)
+        if(listGet(l, i) != (i < LIST_SIZE ? 7 : -1)) return echecTest(" X-- valeur incorrecte");
+    deleteList(&l);
+    printsb("\n\t-test passé\n");
+
+    /* listAppendArray en deux morceaux */
+    printsb( "\ntest listAppendArray...");
+    for(unsigned i = 0; i < LIST_SIZE; i++)
+        values[i] = i;
+    l = createList(1);
+    listAppendArray(l, values, LIST_SIZE / 3);
+    listAppendArray(l, values + LIST_SIZE / 3, LIST_SIZE - LIST_SIZE / 3);
+    listAppendArray(l, values, 0);
+    if(!testUniqueList(l, LIST_SIZE)) return false;
+    printsb("\n\t-test passé\n");
+
+    /* listData : lecture et écriture directes */
+    printsb( "\ntest listData...");
+    data = listData(l);
+    for(unsigned i = 0; i < LIST_SIZE; i++) {
+        if(data[i] != (int)i) return echecTest(" X-- valeur incorrecte");
+        data[i] = 2 * i;
+    }
+    for(unsigned i = 0; i < LIST_SIZE; i++)
+        if(listGet(l, i) != (int)(2 * i)) return echecTest(" X-- écriture non visible");
+    deleteList(&l);
+    printsb("\n\t-test passé\n");
+
+    return true;
+}
+
+
+
 void test_fun(bool(*f)(), int fnb, char* fname) {
     beforeEach();
     bool test_success = f();
@@ -359,6 +436,8 @@ int main() {
     test_fun(testListSet, 32, "testListSet");
     test_fun(testListEmpty, 64, "testListEmpty");
     test_fun(testListCopy, 128, "testListCopy");
+    test_fun(testListCapacity, 256, "testListCapacity");
+    test_fun(testListBulk, 512, "testListBulk");
 
 
     afterAll();
@@ -35,8 +35,8 @@ void printCommand(Command* cmd) {
     if (cmd == NULL) return;
     char cmdPrint[1024];
     memset(cmdPrint, 0, sizeof(cmdPrint));
-    sprintf(cmdPrint, "\t\tModule:%d\n\t\tFileType:%d\n\t\tfile_name:\"%s\"\n\t\thas_log_file:%d\n\t\tlog_file:\"%s\"\n"
-                                    , cmd->module,     cmd->file_type,    cmd->file_name,       cmd->has_log_file,   cmd->log_file
+    sprintf(cmdPrint, "\t\tModule:%d\n\t\tFileType:%d\n\t\tfile_name:\"%s\"\n\t\thas_log_file:%d\n\t\tlog_file:\"%s\"\n\t\tnb_threads:%u\n"
+                                    , cmd->module,     cmd->file_type,    cmd->file_name,       cmd->has_log_file,   cmd->log_file,   cmd->nb_threads
     );
     printsb(cmdPrint);
 }
@@ -251,6 +251,49 @@ bool testInterprete() {
     }
     if (cmd11 != NULL)
         free(cmd11);
+
+    // nombre de threads invalide
+    char* tflag = "-t";
+    char* invalid_threads[] = {"0", "-2", "abc", "4x", "100000"};
+    for (unsigned i = 0; i < 5; i++) {
+        printsb("\n\ntest sur \"interprete -m cs -d test/ressource/duel_1.csv -t ");
+        printsb(invalid_threads[i]);
+        printsb("\"");
+        char* argv12[] = {cmd, mflag, "cs", dflag, duel_src_file, tflag, invalid_threads[i]};
+        Command* cmd12 = try(7, argv12);
+        if (cmd12 != NULL) {
+            printsb("Command extracted:\n");
+            printCommand(cmd12);
+            free(cmd12);
+            return false;
+        }
+    }
+
+    // nombre de threads valide
+    printsb("\n\ntest sur \"interprete -m cs -d test/ressource/duel_1.csv -t 4\"");
+    char* argv13[] = {cmd, mflag, "cs", dflag, duel_src_file, tflag, "4"};
+    Command* cmd13 = try(7, argv13);
+    if (cmd13 == NULL || cmd13->module != SCHULZE || cmd13->nb_threads != 4) {
+        if (cmd13 != NULL) {
+            printsb("\n\tCommand extracted:\n");
+            printCommand(cmd13);
+            free(cmd13);
+        } else {
+            printsb("\n\tInterpreter gave NULL pointer\ntry looking in the log file in test/ressource/");
+        }
+        return false;
+    }
+    free(cmd13);
+
+    // sans -t : nombre de processeurs
+    printsb("\n\ntest sur \"interprete -m cs -d test/ressource/duel_1.csv\"");
+    char* argv14[] = {cmd, mflag, "cs", dflag, duel_src_file};
+    Command* cmd14 = try(5, argv14);
+    if (cmd14 == NULL || cmd14->nb_threads != 0) {
+        if (cmd14 != NULL) free(cmd14);
+        return false;
+    }
+    free(cmd14);
     
     return true;
 }
@@ -0,0 +1,185 @@
+/**
+ * @file test_arena.c
+ * @brief Test sur l'allocateur par région (arène)
+ *
+ * @remarks Les fonction suivantes ne sont pas explicitement testé mais sont
+ * utilisée dans les tests des autres fonctions :
+ * - createArena
+ * - deleteArena
+ */
+
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../src/logger.h"
+#include "../test_utils.h"
+#include "../../src/utils/arena.h"
+
+/* taille des blocs de l'arène de test */
+#define BLOCK_SIZE 1024
+/* nombre d'allocations des tests */
+#define NB_ALLOC 1000
+
+
+/*
+    ===================
+    === OUTILS TEST ===
+    ===================
+*/
+
+#define printsb(msg) addLineStringBuilder(string_builder, msg)
+
+StringBuilder* string_builder;
+int return_value;
+
+void beforeAll() {
+    init_logger(NULL);
+    string_builder = createStringBuilder();
+    return_value = 0;
+}
+
+void afterAll() {
+    deleteStringBuilder(&string_builder);
+    close_logger();
+}
+
+void beforeEach() {
+    emptyStringBuilder(string_builder);
+}
+
+void afterEach() {
+}
+
+bool echecTest(char* msg) {
+    char buff[256] = "\n X-- ";
+    strncat(buff, msg, 200);
+    printsb(buff);
+    return false;
+}
+
+
+/**
+ * @date 16/10/2026
+ * @brief Remplit NB_ALLOC zones de tailles variées (petites et plus grandes qu'un bloc)
+ * puis vérifie alignement et contenu : aucune zone ne doit en écraser une autre
+ *
+ * @note Les zones sont rendues avec memFree (libérées si a == NULL)
+ */
+bool fillAndCheck(Arena* a) {
+    unsigned char* zones[NB_ALLOC];
+    size_t sizes[NB_ALLOC];
+    bool ok = true;
+
+    for(unsigned i = 0; i < NB_ALLOC; i++) {
+        sizes[i] = i % 97 == 0 ? 3 * BLOCK_SIZE : 1 + (i * 37) % 200;
+        zones[i] = memAlloc(a, sizes[i]);
+        if((uintptr_t)zones[i] % ARENA_ALIGN != 0) ok = echecTest("zone mal alignée");
+        memset(zones[i], i % 251, sizes[i]);
+    }
+    for(unsigned i = 0; i < NB_ALLOC && ok; i++)
+        for(size_t j = 0; j < sizes[i] && ok; j++)
+            if(zones[i][j] != i % 251) ok = echecTest("zone écrasée");
+
+    for(unsigned i = 0; i < NB_ALLOC; i++)
+        memFree(a, zones[i]);
+    return ok;
+}
+
+
+/*
+    =============
+    === TESTS ===
+    =============
+*/
+
+bool testArenaAlloc() {
+    Arena* a = createArena(BLOCK_SIZE);
+
+    printsb("\ntest allocations petites et grandes...");
+    if(!fillAndCheck(a)) return false;
+    if(arenaUsed(a) == 0) return echecTest("arenaUsed nul");
+    printsb("\n\t- test passé\n");
+
+    printsb("\ntest taille nulle...");
+    if(arenaAlloc(a, 0) == arenaAlloc(a, 0)) return echecTest("zones identiques");
+    printsb("\n\t- test passé\n");
+
+    deleteArena(&a);
+    if(a != NULL) return echecTest("arène non NULL après suppression");
+    return true;
+}
+
+bool testArenaReset() {
+    Arena* a = createArena(BLOCK_SIZE);
+    void* first;
+
+    printsb("\ntest remise à zéro...");
+    first = arenaAlloc(a, 8);
+    for(unsigned r = 0; r < 3; r++) {
+        if(!fillAndCheck(a)) return false;
+        arenaReset(a);
+        if(arenaUsed(a) != 0) return echecTest("arenaUsed non nul après reset");
+        /* le premier bloc est réutilisé */
+        if(arenaAlloc(a, 8) != first) return echecTest("premier bloc non réutilisé");
+    }
+    printsb("\n\t- test passé\n");
+
+    deleteArena(&a);
+    return true;
+}
+
+bool testMemNoArena() {
+    int* tab;
+
+    printsb("\ntest memAlloc / memCalloc / memFree sans arène...");
+    tab = memCalloc(NULL, NB_ALLOC, sizeof(int));
+    for(unsigned i = 0; i < NB_ALLOC; i++)
+        if(tab[i] != 0) return echecTest("memCalloc non initialisé");
+    memFree(NULL, tab);
+    if(!fillAndCheck(NULL)) return false;
+    printsb("\n\t- test passé\n");
+
+    printsb("\ntest memCalloc avec arène...");
+    Arena* a = createArena(BLOCK_SIZE);
+    memset(arenaAlloc(a, BLOCK_SIZE / 2), 0xff, BLOCK_SIZE / 2);
+    arenaReset(a);
+    tab = memCalloc(a, BLOCK_SIZE / 2 / sizeof(int), sizeof(int));
+    for(unsigned i = 0; i < BLOCK_SIZE / 2 / sizeof(int); i++)
+        if(tab[i] != 0) return echecTest("memCalloc non initialisé");
+    memFree(a, tab);
+    deleteArena(&a);
+    printsb("\n\t- test passé\n");
+
+    return true;
+}
+
+
+
+
+void test_fun(bool(*f)(), int fnb, char* fname) {
+    beforeEach();
+    bool test_success = f();
+    afterEach();
+    if (!test_success) {
+        return_value += fnb;
+        printFailure(fname);
+        printStringBuilder(string_builder);
+    } else printSuccess(fname);
+}
+
+
+int main() {
+    beforeAll();
+
+    test_fun(testArenaAlloc, 1, "testArenaAlloc");
+    test_fun(testArenaReset, 2, "testArenaReset");
+    test_fun(testMemNoArena, 4, "testMemNoArena");
+
+    afterAll();
+
+    return return_value;
+}
@@ -101,6 +101,131 @@ bool testCsvToBale() {
 }
 
 
+bool testCsvLongLines() {
+    const char *label;
+    bool ok = true;
+
+    printsb("test sur bale 13 (lignes > 512 caractères)...");
+    Bale* b = csvToBale("test/ressource/bale_13.csv");
+    if(baleNbVoter(b) != 6 || baleNbCandidat(b) != 150) {
+        deleteBale(&b);
+        return echecTest("\t - mauvaises dimensions");
+    }
+
+    for(unsigned l = 0; l < 6 && ok; l++)
+        for(unsigned c = 0; c < 150 && ok; c++)
+            ok = baleGetValue(b, l, c) == ((c + l) % 17 == 0 ? -1 : (int)((c * 7 + l * 3) % 150 + 1));
+    if(!ok) {
+        deleteBale(&b);
+        return echecTest("\t - mauvaise valeur");
+    }
+
+    label = baleColumnToLabel(b, 149);
+    ok = strcmp(label, "Q01->150 - Candidat numero 150") == 0;
+    deleteBale(&b);
+    if(!ok) return echecTest("\t - mauvais label");
+    printsb("\t - test passé");
+
+    return true;
+}
+
+
+bool sameBale(Bale *b1, Bale *b2) {
+    if(baleNbLine(b1) != baleNbLine(b2) || baleNbCandidat(b1) != baleNbCandidat(b2))
+        return false;
+    for(unsigned l = 0; l < baleNbLine(b1); l++)
+        for(unsigned c = 0; c < baleNbCandidat(b1); c++)
+            if(baleGetValue(b1, l, c) != baleGetValue(b2, l, c))
+                return false;
+    return true;
+}
+
+
+bool testCsvParallel() {
+    char file[64];
+    unsigned nb_threads[] = {2, 3, 7, 64};
+    Bale *ref, *b;
+    bool ok;
+
+    for(unsigned f = 1; f <= 13; f++) {
+        snprintf(file, 64, "test/ressource/bale_%u.csv", f);
+        printsb(file);
+        ref = csvToBaleParallel(file, 1);
+        for(unsigned i = 0; i < 4; i++) {
+            b = csvToBaleParallel(file, nb_threads[i]);
+            ok = sameBale(ref, b);
+            deleteBale(&b);
+            if(!ok) {
+                deleteBale(&ref);
+                return echecTest("\t - ballot différent de la lecture séquentielle");
+            }
+        }
+        deleteBale(&ref);
+        printsb("\t - test passé");
+    }
+
+    return true;
+}
+
+
+bool testCsvWideValues() {
+    int ref[5][3] = {{1,2,3}, {200,1,-1}, {2,3,1}, {1,70000,2}, {3,1,2}};
+    unsigned nb_threads[] = {1, 2, 5};
+    bool ok = true;
+    Bale *b;
+
+    printsb("test valeurs trop larges pour les cases (rangs 200 et 70000, 3 candidats)...");
+    for(unsigned i = 0; i < 3 && ok; i++) {
+        b = csvToBaleParallel("test/ressource/unit/bale_wide.csv", nb_threads[i]);
+        ok = baleNbLine(b) == 5 && baleCellSize(b) == 4;
+        for(unsigned l = 0; l < 5 && ok; l++)
+            for(unsigned c = 0; c < 3 && ok; c++)
+                ok = baleGetValue(b, l, c) == ref[l][c];
+        deleteBale(&b);
+    }
+    if(!ok) return echecTest("\t - valeur perdue");
+    printsb("\t - test passé");
+
+    return true;
+}
+
+
+bool testCsvBaleToDuel() {
+    char file[64];
+    unsigned nb_voters, nbc;
+    unsigned nb_threads[] = {1, 2, 3, 7};
+    Bale *bale;
+    Duel *ref, *d;
+    bool ok;
+
+    for(unsigned f = 1; f <= 13; f++) {
+        snprintf(file, 64, "test/ressource/bale_%u.csv", f);
+        printsb(file);
+        bale = csvToBale(file);
+        ref = duelFromBale(bale);
+        nbc = duelNbCandidat(ref);
+        ok = true;
+
+        /* lecture séquentielle puis sur 2, 3 et 7 threads */
+        for(unsigned i = 0; i < 4 && ok; i++) {
+            d = csvBaleToDuelParallel(file, &nb_voters, nb_threads[i]);
+            ok = nb_voters == baleNbVoter(bale) && duelNbCandidat(d) == nbc;
+            for(unsigned x = 0; x < nbc && ok; x++)
+                for(unsigned y = 0; y < nbc && ok; y++)
+                    ok = duelGetValue(ref, x, y) == duelGetValue(d, x, y);
+            deleteDuel(&d);
+        }
+
+        deleteBale(&bale);
+        deleteDuel(&ref);
+        if(!ok) return echecTest("\t - duel différent de duelFromBale");
+        printsb("\t - test passé");
+    }
+
+    return true;
+}
+
+
 bool testCsvToDuel() {
     Duel* d;
 
@@ -173,6 +298,10 @@ int main() {
     beforeAll();
 
     test_fun(testCsvToBale, 1, "testCsvToBale");
+    test_fun(testCsvLongLines, 1, "testCsvLongLines");
+    test_fun(testCsvParallel, 1, "testCsvParallel");
+    test_fun(testCsvWideValues, 1, "testCsvWideValues");
+    test_fun(testCsvBaleToDuel, 1, "testCsvBaleToDuel");
     test_fun(testCsvToDuel, 1, "testCsvToDuel");
 
 